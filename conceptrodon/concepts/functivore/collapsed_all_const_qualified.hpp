@@ -0,0 +1,19 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_COLLAPSED_ALL_CONST_QUALIFIED_H
+#define CONCEPTRODON_FUNCTIVORE_COLLAPSED_ALL_CONST_QUALIFIED_H
+
+#include "conceptrodon/concepts/mouldivore/collapsed_all_passed.hpp"
+#include "conceptrodon/metafunctions/functivore/is_const.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+
+template<typename...Args>
+concept CollapsedAllConstQualified
+= Mouldivore::CollapsedAllPassed<IsConst, Args...>;
+
+}}
+
+#endif
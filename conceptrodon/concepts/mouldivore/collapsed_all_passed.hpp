@@ -0,0 +1,23 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_COLLAPSED_ALL_PASSED_H
+#define CONCEPTRODON_MOULDIVORE_COLLAPSED_ALL_PASSED_H
+
+#include "conceptrodon/concepts/mouldivore/passed.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+
+// The whole pack is evaluated once into a single variable.
+// `Passed` turns a missing `value` into false instead of a hard error.
+template<template<typename...> class Predicate, typename...Elements>
+constexpr bool CollapsedAllPassed_v
+{(...&&Passed<Predicate, Elements>)};
+
+template<template<typename...> class Predicate, typename...Elements>
+concept CollapsedAllPassed = CollapsedAllPassed_v<Predicate, Elements...>;
+
+}}
+
+#endif
@@ -0,0 +1,18 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_COLLAPSED_ALL_MOLDFUL_H
+#define CONCEPTRODON_OMENNIVORE_COLLAPSED_ALL_MOLDFUL_H
+
+#include "conceptrodon/metafunctions/omennivore/is_moldful.hpp"
+#include "conceptrodon/concepts/mouldivore/collapsed_all_passed.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+
+template<typename...Args>
+concept CollapsedAllMoldful = Mouldivore::CollapsedAllPassed<IsMoldful, Args...>;
+
+}}
+
+#endif
@@ -0,0 +1,21 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_COLLAPSED_ALL_PASSED_H
+#define CONCEPTRODON_TYPELIVORE_COLLAPSED_ALL_PASSED_H
+
+#include "conceptrodon/concepts/typelivore/passed.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename Predicate, auto...Variables>
+constexpr bool CollapsedAllPassed_v
+{(...&&Passed<Predicate, Variables>)};
+
+template<typename Predicate, auto...Variables>
+concept CollapsedAllPassed = CollapsedAllPassed_v<Predicate, Variables...>;
+
+}}
+
+#endif
@@ -0,0 +1,21 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_COLLAPSED_ALL_ZERO_H
+#define CONCEPTRODON_TYPELIVORE_COLLAPSED_ALL_ZERO_H
+
+#include "conceptrodon/concepts/typelivore/zero.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Args>
+constexpr bool CollapsedAllZero_v
+{(...&&Zero<Args>)};
+
+template<typename...Args>
+concept CollapsedAllZero = CollapsedAllZero_v<Args...>;
+
+}}
+
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_DISPATCH_H
+#define CONCEPTRODON_FUNCTIVORE_DISPATCH_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/functivore/get_parameter_types.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+
+template<typename...Handlers>
+struct Dispatch
+{
+    // A handler accepts an event if its only parameter names the event type.
+    // Handlers with other parameter lists accept nothing.
+    template<typename, typename>
+    struct Accept
+    { static constexpr bool value {false}; };
+
+    template<typename Parameter, typename Event>
+    struct Accept<Capsule<Parameter>, Event>
+    { static constexpr bool value {std::is_same_v<std::remove_cvref_t<Parameter>, Event>}; };
+
+    template<typename...Events>
+    struct ProtoMold
+    {
+        using pointer_type = void(*)(std::variant<Events...> const&, Handlers&...);
+
+        // Indices of the handlers that accept the event and can be invoked with it.
+        // Handlers taking `Event&` or `Event&&` cannot bind the event and are skipped.
+        template<typename Event>
+        static constexpr auto routes
+        {
+            Ominuci::sift
+            <
+                (
+                    Accept<typename GetParameterTypes<Capsule>::template Mold<Handlers>, Event>::value
+                    && std::is_invocable_v<Handlers&, Event const&>
+                )...
+            >
+        };
+
+        template<typename Event>
+        static constexpr void deliver(Event const& event, Handlers&...handlers)
+        {
+            [&]<size_t...I>(std::index_sequence<I...>)
+            {
+                auto handler_refs {std::tie(handlers...)};
+                (std::invoke(std::get<routes<Event>[I]>(handler_refs), event), ...);
+            }(std::make_index_sequence<routes<Event>.size()>{});
+        }
+
+        template<auto I>
+        struct Entry
+        {
+            static constexpr void invoke(std::variant<Events...> const& event, Handlers&...handlers)
+            { deliver(std::get<I>(event), handlers...); }
+        };
+
+        template<typename>
+        struct Table {};
+
+        template<size_t...I>
+        struct Table<std::index_sequence<I...>>
+        {
+            static constexpr std::array<pointer_type, sizeof...(Events)> value
+            {&Entry<I>::invoke...};
+        };
+
+        static constexpr auto value
+        {Table<std::make_index_sequence<sizeof...(Events)>>::value};
+
+        static constexpr void dispatch(std::variant<Events...> const& event, Handlers&...handlers)
+        {
+            if (event.valueless_by_exception())
+            { throw std::bad_variant_access {}; }
+
+            value[event.index()](event, handlers...);
+        }
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,29 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_TABULATE_H
+#define CONCEPTRODON_FUNCTIVORE_TABULATE_H
+
+#include "conceptrodon/metafunctions/functivore/analyzer.hpp"
+#include "conceptrodon/metafunctions/microbiota/functilis/columns.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+
+template<typename>
+struct Tabulate {};
+
+// Each callable is analyzed once, and every column reads from that analysis.
+// Callables that only differ in cv-ref qualifiers share one analysis,
+// and callables with the same signature share one `AnalyzerPrototype`.
+template
+<
+    template<typename...> class Container,
+    typename...Callables
+>
+struct Tabulate<Container<Callables...>>
+: public Functilis::Columns<Analyzer<Callables>...> {};
+
+}}
+
+#endif
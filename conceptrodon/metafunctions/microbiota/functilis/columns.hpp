@@ -0,0 +1,28 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTILIS_COLUMNS_H
+#define CONCEPTRODON_FUNCTILIS_COLUMNS_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+namespace Conceptrodon {
+namespace Functilis {
+
+template<typename...Analyses>
+struct Columns
+{
+    static constexpr size_t size {sizeof...(Analyses)};
+
+    using return_types = Capsule<typename Analyses::result_type...>;
+
+    using parameter_types = Capsule<typename Analyses::template parameter_types<Capsule>...>;
+
+    using flags = Shuttle<Analyses::value...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,191 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOLDIAE_PEEPHOLE_H
+#define CONCEPTRODON_MOLDIAE_PEEPHOLE_H
+
+#include <tuple>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/moy.hpp"
+#include "conceptrodon/metafunctions/omennivore/send.hpp"
+#include "conceptrodon/metafunctions/microbiota/moldiae/repack.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/typical_turn_over.hpp"
+#include "conceptrodon/metafunctions/mouldivore/conceal.hpp"
+#include "conceptrodon/metafunctions/mouldivore/cognate_reverse.hpp"
+
+namespace Conceptrodon {
+namespace Moldiae {
+
+// `Faithful<Operation>::value` is true if `Omennivore::Send` unpacks
+// `Operation<Elements...>` back into `Elements...` for every `Elements...`.
+// Only such an operation can be skipped when its result is sent to the next step.
+// This can not be told by probing `Operation`, since an alias may filter or reorder its arguments.
+// Therefore, only the class templates specialized below are trusted;
+// other class templates opt in by specializing `Faithful`.
+template<template<typename...> class>
+struct Faithful
+{ static constexpr bool value {false}; };
+
+template<>
+struct Faithful<Capsule>
+{ static constexpr bool value {true}; };
+
+template<>
+struct Faithful<std::tuple>
+{ static constexpr bool value {true}; };
+
+// `Assembly` is a transformation whose elements pass through `Stations` from left to right.
+template<template<typename...> class Operation, template<typename> class...Stations>
+struct Assembly
+{
+    template<typename Element, template<typename> class...>
+    struct Detail
+    { using type = Element; };
+
+    template
+    <
+        typename Element,
+        template<typename> class Station,
+        template<typename> class...Others
+    >
+    struct Detail<Element, Station, Others...>
+    : public Detail<typename Station<Element>::type, Others...> {};
+
+    template<typename...Elements>
+    using Mold = Operation<typename Detail<Elements, Stations...>::type...>;
+};
+
+// Transformations expose themselves as an `Assembly` through `Assemble`.
+template<typename Step>
+struct Normalize
+{ using type = Step; };
+
+template<typename Step>
+requires requires { typename Step::template Assemble<Assembly>; }
+struct Normalize<Step>
+{ using type = Step::template Assemble<Assembly>; };
+
+/**** Rewrite Rules ****/
+// `Fuse<Former, Latter>::type` is a single step equivalent to `Former` followed by `Latter`.
+// `Fuse` is left empty if no rule applies.
+template<typename, typename>
+struct Fuse {};
+
+// `Conceal` only wraps its arguments, which are sent to the next step right away.
+template<template<typename...> class Operation, typename Latter>
+struct Fuse<Mouldivore::Conceal<Operation>, Latter>
+{ using type = Latter; };
+
+template<template<typename...> class Container, typename Latter>
+requires Faithful<Container>::value
+struct Fuse<Moy<Container>, Latter>
+{ using type = Latter; };
+
+// Two reversals cancel each other out.
+template<template<typename...> class Former, template<typename...> class Latter>
+requires Faithful<Former>::value
+struct Fuse<Mouldivore::CognateReverse<Former>, Mouldivore::CognateReverse<Latter>>
+{ using type = Moy<Latter>; };
+
+// Packing the result into another container changes the operation of the former step.
+template<template<typename...> class Former, template<typename...> class Latter>
+requires Faithful<Former>::value
+struct Fuse<Mouldivore::CognateReverse<Former>, Moy<Latter>>
+{ using type = Mouldivore::CognateReverse<Latter>; };
+
+template<template<typename...> class Former, template<typename...> class Latter>
+requires Faithful<Former>::value
+struct Fuse<Repack<Former>, Moy<Latter>>
+{ using type = Repack<Latter>; };
+
+template
+<
+    template<typename...> class Former,
+    template<typename> class...Stations,
+    template<typename...> class Latter
+>
+requires Faithful<Former>::value
+struct Fuse<Assembly<Former, Stations...>, Moy<Latter>>
+{ using type = Assembly<Latter, Stations...>; };
+
+// Adjacent transformations share a single pass over the elements.
+template
+<
+    template<typename...> class Former,
+    template<typename> class...FormerStations,
+    template<typename...> class Latter,
+    template<typename> class...LatterStations
+>
+requires Faithful<Former>::value
+struct Fuse<Assembly<Former, FormerStations...>, Assembly<Latter, LatterStations...>>
+{ using type = Assembly<Latter, FormerStations..., LatterStations...>; };
+
+/**** Peephole ****/
+// `Push` places a step on top of the stack, which holds the kept steps in reverse order.
+// Whenever the step fuses with the top, the result is pushed again,
+// so that it can fuse with the steps underneath.
+template<typename, typename>
+struct Push {};
+
+template<typename...Items, typename Step>
+struct Push<Capsule<Items...>, Step>
+{ using type = Capsule<Step, Items...>; };
+
+template<typename Top, typename...Items, typename Step>
+requires requires
+{
+    typename Fuse
+    <
+        typename Normalize<Top>::type,
+        typename Normalize<Step>::type
+    >::type;
+}
+struct Push<Capsule<Top, Items...>, Step>
+: public Push
+<
+    Capsule<Items...>,
+    typename Fuse
+    <
+        typename Normalize<Top>::type,
+        typename Normalize<Step>::type
+    >::type
+> {};
+
+template<typename Stack, typename...>
+struct Scan
+{ using type = Stack; };
+
+template<typename Stack, typename Step, typename...Others>
+struct Scan<Stack, Step, Others...>
+: public Scan<typename Push<Stack, Step>::type, Others...> {};
+
+template<typename...Steps>
+struct Peephole
+{
+    using type = Scan<Capsule<>, Steps...>::type
+    ::template UniRoad<Typella::TypicalTurnOver>::type;
+};
+
+// `Travel` invokes the steps one after another.
+// Each result is unpacked by `Omennivore::Send` for the next step, like in `Trek`.
+template<typename...>
+struct Travel {};
+
+template<typename Step>
+struct Travel<Step>
+{
+    template<typename...Elements>
+    using Mold = Step::template Mold<Elements...>;
+};
+
+template<typename Step, typename...Others>
+struct Travel<Step, Others...>
+{
+    template<typename...Elements>
+    using Mold = Omennivore::Send<typename Step::template Mold<Elements...>>
+    ::template UniRoad<Travel<Others...>::template Mold>;
+};
+
+}}
+
+#endif
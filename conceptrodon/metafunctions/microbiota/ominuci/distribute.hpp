@@ -0,0 +1,56 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_DISTRIBUTE_H
+#define CONCEPTRODON_OMINUCI_DISTRIBUTE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// Distribute the elements into `Count` buckets.
+// `Buckets[I]` is the bucket of the `I`th element.
+// Elements keep their relative order within a bucket.
+template<typename, auto Buckets, size_t Count>
+struct Distribute {};
+
+template<typename...Elements, auto Buckets, size_t Count>
+struct Distribute<Capsule<Elements...>, Buckets, Count>
+{
+    template<typename>
+    struct Detail {};
+
+    // Each bucket pastes the elements assigned to it.
+    // Elements are never looked up by index,
+    // which would cost a search through the whole list per element.
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        template<size_t B>
+        using Bucket = Cotanivore::TypicalPaste
+        <
+            Capsule<>,
+            std::conditional_t<Buckets[I] == B, Capsule<Elements>, Capsule<>>...
+        >::type;
+
+        template<typename>
+        struct Hidden {};
+
+        template<size_t...B>
+        struct Hidden<std::index_sequence<B...>>
+        { using type = Capsule<Bucket<B>...>; };
+
+        using type = Hidden<std::make_index_sequence<Count>>::type;
+    };
+
+    using type = Detail<std::index_sequence_for<Elements...>>::type;
+};
+
+}}
+
+#endif
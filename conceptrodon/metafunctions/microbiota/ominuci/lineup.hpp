@@ -0,0 +1,54 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_LINEUP_H
+#define CONCEPTRODON_OMINUCI_LINEUP_H
+
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/utilities/label.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/varybivore/amid.hpp"
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+template<typename>
+struct Lineup {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Lineup<Container<Elements...>>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Tyy<Elements>, std::integral_constant<size_t, I>>...
+    { using Label<Tyy<Elements>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    struct Hidden
+    {
+        using type = decltype
+        (
+            Detail<std::index_sequence_for<Elements...>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::type;
+    };
+
+    template<size_t I>
+    using UniPage = Hidden<I>::type;
+};
+
+template<template<auto...> class Sequence, auto...Variables>
+struct Lineup<Sequence<Variables...>>
+: public Varybivore::Amid<Variables...> {};
+
+template<template<typename, auto...> class Sequence, typename Type, auto...Variables>
+struct Lineup<Sequence<Type, Variables...>>
+: public Varybivore::Amid<Variables...> {};
+
+}}
+
+#endif
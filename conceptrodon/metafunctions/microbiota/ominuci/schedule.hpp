@@ -0,0 +1,92 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_SCHEDULE_H
+#define CONCEPTRODON_OMINUCI_SCHEDULE_H
+
+#include <array>
+#include <cstddef>
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// A dependency order of `Length` nodes.
+template<size_t Length>
+struct Schedule
+{
+    // Only the first `size` entries are used.
+    std::array<size_t, Length> order {};
+
+    // `size` falls short of `Length` if some nodes lie on or behind a cycle.
+    size_t size {0};
+};
+
+// Kahn's algorithm.
+// The `I`th node depends on `targets[starts[I]]`, ..., `targets[starts[I + 1] - 1]`.
+// Targets not less than `Length` are ignored.
+// Nodes that become ready at the same time keep their relative order.
+template<size_t Length, size_t Edges>
+constexpr auto schedule
+(
+    std::array<size_t, Length + 1> const & starts,
+    std::array<size_t, Edges> const & targets
+)
+-> Schedule<Length>
+{
+    // The dependents of every node, grouped by the node they depend on.
+    std::array<size_t, Length + 1> offsets {};
+    std::array<size_t, Edges> dependents {};
+    std::array<size_t, Length> pending {};
+
+    for (size_t i {0}; i < Length; i++)
+    {
+        for (size_t k {starts[i]}; k < starts[i + 1]; k++)
+        {
+            if (targets[k] < Length)
+            {
+                offsets[targets[k] + 1]++;
+                pending[i]++;
+            }
+        }
+    }
+
+    for (size_t i {0}; i < Length; i++)
+    { offsets[i + 1] += offsets[i]; }
+
+    std::array<size_t, Length + 1> cursors {offsets};
+
+    for (size_t i {0}; i < Length; i++)
+    {
+        for (size_t k {starts[i]}; k < starts[i + 1]; k++)
+        {
+            if (targets[k] < Length)
+            { dependents[cursors[targets[k]]++] = i; }
+        }
+    }
+
+    // `order` doubles as the queue of ready nodes.
+    Schedule<Length> result {};
+
+    for (size_t i {0}; i < Length; i++)
+    {
+        if (pending[i] == 0)
+        { result.order[result.size++] = i; }
+    }
+
+    for (size_t front {0}; front < result.size; front++)
+    {
+        size_t node {result.order[front]};
+
+        for (size_t k {offsets[node]}; k < offsets[node + 1]; k++)
+        {
+            if (--pending[dependents[k]] == 0)
+            { result.order[result.size++] = dependents[k]; }
+        }
+    }
+
+    return result;
+}
+
+}}
+
+#endif
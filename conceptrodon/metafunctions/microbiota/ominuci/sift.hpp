@@ -0,0 +1,35 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_SIFT_H
+#define CONCEPTRODON_OMINUCI_SIFT_H
+
+#include <array>
+#include <cstddef>
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// Indices of the flags that are true.
+template<bool...Flags>
+constexpr auto sift
+{
+    []()
+    {
+        std::array<bool, sizeof...(Flags)> flags {Flags...};
+        std::array<size_t, (0 + ... + Flags)> indices {};
+        size_t counter {0};
+
+        for (size_t i {0}; i < sizeof...(Flags); i++)
+        {
+            if (flags[i])
+            { indices[counter++] = i; }
+        }
+
+        return indices;
+    }()
+};
+
+}}
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_TALLY_H
+#define CONCEPTRODON_OMINUCI_TALLY_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// An open-addressing hash table counting `Length` keys.
+template<size_t Length>
+struct Tally
+{
+    // At least half of the slots stay empty, which keeps probes short.
+    static constexpr size_t capacity {std::bit_ceil(2 * Length + 1)};
+
+    std::array<uint64_t, capacity> slots {};
+
+    // Zero marks an empty slot.
+    std::array<size_t, capacity> multiplicities {};
+
+    // `firsts[I]` is true if the `I`th key has not appeared before.
+    std::array<bool, Length> firsts {};
+
+    // Multiplicities of the distinct keys in the order they first appear.
+    // Only the first `size` entries are used.
+    std::array<size_t, Length> counts {};
+
+    size_t size {0};
+
+    constexpr auto locate(uint64_t key) const -> size_t
+    {
+        size_t position {(key ^ (key >> 32)) & (capacity - 1)};
+
+        while (multiplicities[position] != 0 && slots[position] != key)
+        { position = (position + 1) & (capacity - 1); }
+
+        return position;
+    }
+
+    constexpr auto count(uint64_t key) const -> size_t
+    { return multiplicities[locate(key)]; }
+};
+
+// Count the keys in one pass instead of comparing every pair.
+template<uint64_t...Keys>
+constexpr auto tally
+{
+    []()
+    {
+        std::array<uint64_t, sizeof...(Keys)> keys {Keys...};
+        std::array<size_t, sizeof...(Keys)> positions {};
+        Tally<sizeof...(Keys)> result {};
+
+        for (size_t i {0}; i < sizeof...(Keys); i++)
+        {
+            positions[i] = result.locate(keys[i]);
+
+            if (result.multiplicities[positions[i]]++ == 0)
+            {
+                result.slots[positions[i]] = keys[i];
+                result.firsts[i] = true;
+            }
+        }
+
+        for (size_t i {0}; i < sizeof...(Keys); i++)
+        {
+            if (result.firsts[i])
+            { result.counts[result.size++] = result.multiplicities[positions[i]]; }
+        }
+
+        return result;
+    }()
+};
+
+}}
+
+#endif
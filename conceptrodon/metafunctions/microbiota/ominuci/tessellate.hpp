@@ -0,0 +1,123 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_TESSELLATE_H
+#define CONCEPTRODON_OMINUCI_TESSELLATE_H
+
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/fore.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/shear.hpp"
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// Group `G` starts from item `G * Stride` and holds at most `Size` items.
+// A shorter trailing group is kept only if the tiling is `Ragged`.
+template<size_t Length, size_t Size, size_t Stride, bool Ragged>
+struct Tiling
+{
+    static constexpr size_t count
+    {
+        Ragged ? (Length + Stride - 1) / Stride
+        : Length < Size ? 0 : (Length - Size) / Stride + 1
+    };
+
+    static constexpr auto start(size_t group) -> size_t
+    { return group * Stride; }
+
+    static constexpr auto width(size_t group) -> size_t
+    { return Length - start(group) < Size ? Length - start(group) : Size; }
+
+    static constexpr auto end(size_t group) -> size_t
+    { return start(group) + width(group); }
+};
+
+template<typename...Treasures>
+using Unwrap = Capsule<typename Treasures::type...>;
+
+template<typename...Treasures>
+using Unveil = Shuttle<Treasures::value...>;
+
+// Groups from `Low` to `High` are built from the treasures
+// that begin at the first item of group `Low`.
+// The range is halved at each level,
+// so every treasure is moved a logarithmic number of times
+// instead of once per group.
+template
+<
+    typename Tiles,
+    template<typename...> class Assemble,
+    size_t Low = 0,
+    size_t High = Tiles::count
+>
+struct Tessellate
+{
+    static constexpr size_t middle {(Low + High) / 2};
+
+    template<typename>
+    struct Detail {};
+
+    template<typename...Treasures>
+    struct Detail<Capsule<Treasures...>>
+    {
+        using type = Cotanivore::TypicalPaste
+        <
+            typename Tessellate<Tiles, Assemble, Low, middle>::template Detail
+            <
+                decltype
+                (
+                    Typella::Fore<std::make_index_sequence<Tiles::end(middle - 1) - Tiles::start(Low)>>
+                    ::template idyl<Capsule>(Tyy<Treasures>{}...)
+                )
+            >::type,
+            typename Tessellate<Tiles, Assemble, middle, High>::template Detail
+            <
+                decltype
+                (
+                    Typella::Shear<std::make_index_sequence<Tiles::start(middle) - Tiles::start(Low)>>
+                    ::template idyl<Capsule>(Tyy<Treasures>{}...)
+                )
+            >::type
+        >::type;
+    };
+};
+
+template<typename Tiles, template<typename...> class Assemble, size_t Low, size_t High>
+requires (Low == High)
+struct Tessellate<Tiles, Assemble, Low, High>
+{
+    // Without groups, the result is empty.
+    template<typename>
+    struct Detail
+    { using type = Capsule<>; };
+};
+
+template<typename Tiles, template<typename...> class Assemble, size_t Low, size_t High>
+requires (Low + 1 == High)
+struct Tessellate<Tiles, Assemble, Low, High>
+{
+    template<typename>
+    struct Detail {};
+
+    template<typename...Treasures>
+    struct Detail<Capsule<Treasures...>>
+    {
+        using type = Capsule
+        <
+            decltype
+            (
+                Typella::Fore<std::make_index_sequence<Tiles::width(Low)>>
+                ::template idyl<Assemble>(Tyy<Treasures>{}...)
+            )
+        >;
+    };
+};
+
+}}
+
+#endif
@@ -0,0 +1,36 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_TRAIL_H
+#define CONCEPTRODON_OMINUCI_TRAIL_H
+
+#include "conceptrodon/metafunctions/omennivore/press.hpp"
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// A record of packed arguments that grows one link at a time.
+// Each link only refers to the record before it,
+// so extending the record never copies the earlier items.
+// `void` is the empty record.
+template<typename Earlier, typename Item>
+struct Trail {};
+
+// `Retrace<Operation, Record>::type` presses the items of the record
+// into `Operation` in the order they were recorded.
+// It takes both parameters at once, so that every link only costs
+// one level of instantiation depth.
+template<typename Operation, typename Record>
+struct Retrace
+{ using type = Operation; };
+
+template<typename Operation, typename Earlier, typename Item>
+struct Retrace<Operation, Trail<Earlier, Item>>
+{
+    using type = Omennivore::Press<typename Retrace<Operation, Earlier>::type>
+    ::template Mold<Item>;
+};
+
+}}
+
+#endif
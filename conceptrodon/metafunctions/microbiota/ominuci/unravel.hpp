@@ -0,0 +1,32 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMINUCI_UNRAVEL_H
+#define CONCEPTRODON_OMINUCI_UNRAVEL_H
+
+#include <array>
+#include <cstddef>
+
+namespace Conceptrodon {
+namespace Ominuci {
+
+// Decompose a flat index into its mixed-radix digits.
+// The last extent varies the fastest.
+template<size_t...Extents>
+consteval auto unravel(size_t index)
+{
+    std::array<size_t, sizeof...(Extents)> extents {Extents...};
+    std::array<size_t, sizeof...(Extents)> digits {};
+
+    for (size_t i {sizeof...(Extents)}; i != 0; i--)
+    {
+        digits[i - 1] = index % extents[i - 1];
+        index /= extents[i - 1];
+    }
+
+    return digits;
+}
+
+}}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELLA_DEPENDENCY_H
+#define CONCEPTRODON_TYPELLA_DEPENDENCY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/label.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+
+namespace Conceptrodon {
+namespace Typella {
+
+// A node of a dependency graph, written as `Label<Subsystem, Capsule<Dependencies...>>`.
+// Each node is inspected on its own, so that the instantiations are shared among graphs.
+template<typename Item>
+struct Dependency
+{
+    static_assert
+    (
+        not std::is_same_v<Item, Item>,
+        "Conceptrodon: a dependency node must be `Label<Subsystem, Capsule<Dependencies...>>`."
+    );
+};
+
+template<typename Subsystem, typename...Dependencies>
+struct Dependency<Label<Subsystem, Capsule<Dependencies...>>>
+{
+    using type = Subsystem;
+
+    static constexpr uint64_t key {Typelivore::Fingerprint<Subsystem>::value};
+
+    static constexpr size_t size {sizeof...(Dependencies)};
+
+    static constexpr std::array<uint64_t, sizeof...(Dependencies)> keys
+    {Typelivore::Fingerprint<Dependencies>::value...};
+
+    // `Roster` derives from `Tyy` of every subsystem.
+    template<typename Roster>
+    static constexpr bool listed {(...&&std::is_base_of_v<Tyy<Dependencies>, Roster>)};
+};
+
+template<typename...Subsystems>
+struct Roster
+: public Tyy<Subsystems>... {};
+
+}}
+
+#endif
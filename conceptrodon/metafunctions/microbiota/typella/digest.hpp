@@ -0,0 +1,29 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELLA_DIGEST_H
+#define CONCEPTRODON_TYPELLA_DIGEST_H
+
+#include <cstdint>
+#include <string_view>
+
+namespace Conceptrodon {
+namespace Typella {
+
+// 64-bit FNV-1a
+consteval auto digest(std::string_view signature) -> uint64_t
+{
+    uint64_t hash {14695981039346656037ULL};
+
+    for (char letter : signature)
+    {
+        hash ^= static_cast<unsigned char>(letter);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+}}
+
+#endif
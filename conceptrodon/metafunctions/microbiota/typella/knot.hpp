@@ -0,0 +1,177 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELLA_KNOT_H
+#define CONCEPTRODON_TYPELLA_KNOT_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/cotanis/typical_paste.hpp"
+
+namespace Conceptrodon {
+namespace Typella {
+
+template<typename Left, typename Right>
+struct Knot;
+
+/******************************************************************************************************/
+// A rope is perfect if it is a leaf or it knots two perfect ropes of the same height.
+// Pasting a perfect rope carries it into the spine of the other rope like a binary counter,
+// so that repeated appending or prepending creates a constant number of knots on average
+// and keeps the height logarithmic.
+template<typename Left, typename Right>
+struct CarryBack
+{ using type = Knot<Left, Right>; };
+
+template<typename Left, typename Right>
+requires (not Left::perfect)
+&& Left::right::perfect
+&& (Left::right::height == Right::height)
+struct CarryBack<Left, Right>
+{
+    using type = CarryBack
+    <
+        typename Left::left,
+        Knot<typename Left::right, Right>
+    >::type;
+};
+
+template<typename Left, typename Right>
+struct CarryFront
+{ using type = Knot<Left, Right>; };
+
+template<typename Left, typename Right>
+requires (not Right::perfect)
+&& Right::left::perfect
+&& (Right::left::height == Left::height)
+struct CarryFront<Left, Right>
+{
+    using type = CarryFront
+    <
+        Knot<Left, typename Right::left>,
+        typename Right::right
+    >::type;
+};
+
+// Empty ropes are dropped instead of knotted.
+template<typename Left, typename Right>
+struct Concatenate
+{ using type = Knot<Left, Right>; };
+
+template<typename Left, typename Right>
+requires (Left::size() == 0)
+struct Concatenate<Left, Right>
+{ using type = Right; };
+
+template<typename Left, typename Right>
+requires (Left::size() != 0 && Right::size() == 0)
+struct Concatenate<Left, Right>
+{ using type = Left; };
+
+template<typename Left, typename Right>
+requires (Left::size() != 0 && Right::size() != 0 && Right::perfect)
+struct Concatenate<Left, Right>
+{ using type = CarryBack<Left, Right>::type; };
+
+template<typename Left, typename Right>
+requires (Left::size() != 0 && Right::size() != 0 && not Right::perfect && Left::perfect)
+struct Concatenate<Left, Right>
+{ using type = CarryFront<Left, Right>::type; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+template<typename Origin, typename...Ropes>
+struct Stitch
+{ using type = Origin; };
+
+template<typename Origin, typename First, typename...Others>
+struct Stitch<Origin, First, Others...>
+{ using type = Stitch<typename Concatenate<Origin, First>::type, Others...>::type; };
+
+// `Gather` collects the element list of every leaf from left to right.
+// Only the lists are spliced at each knot; the elements are pasted once by `Unspool`.
+template<typename>
+struct Gather;
+
+template<typename, typename>
+struct Splice {};
+
+template<typename...LeftLists, typename...RightLists>
+struct Splice<Capsule<LeftLists...>, Capsule<RightLists...>>
+{ using type = Capsule<LeftLists..., RightLists...>; };
+
+template<typename Origin>
+struct Gather
+{ using type = Capsule<typename Origin::template UniRoad<Capsule>>; };
+
+template<typename Left, typename Right>
+struct Gather<Knot<Left, Right>>
+{
+    using type = Splice
+    <
+        typename Gather<Left>::type,
+        typename Gather<Right>::type
+    >::type;
+};
+
+template<typename Origin, template<typename...> class Container>
+struct Unspool
+{
+    using type = Gather<Origin>::type
+    ::template UniRoad<Cotanis::TypicalPaste>::type
+    ::template UniRoad<Container>;
+};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+template<typename Left, typename Right>
+struct Knot
+{
+    using left = Left;
+    using right = Right;
+
+    static constexpr size_t height
+    {1 + (Left::height < Right::height ? Right::height : Left::height)};
+
+    static constexpr bool perfect
+    {Left::perfect && Right::perfect && Left::height == Right::height};
+
+    static constexpr size_t size() { return length; }
+
+    template<size_t I>
+    struct Hidden
+    { using type = Right::template Among<I - Left::size()>; };
+
+    template<size_t I>
+    requires (I < Left::size())
+    struct Hidden<I>
+    { using type = Left::template Among<I>; };
+
+    template<size_t I>
+    using Among = Hidden<I>::type;
+
+    template<typename...Ropes>
+    using Paste = Stitch<Knot, Ropes...>::type;
+
+    template<template<typename...> class...Agreements>
+    using Road = Unspool<Knot, Agreements...>::type;
+
+    template<template<typename...> class Container>
+    using UniRoad = Unspool<Knot, Container>::type;
+
+
+private:
+    // The total is cached at every knot, so it is never recomputed by walking the tree.
+    static constexpr size_t length {Left::size() + Right::size()};
+};
+/******************************************************************************************************/
+
+}}
+
+#endif
@@ -0,0 +1,36 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELLA_RAVEL_H
+#define CONCEPTRODON_TYPELLA_RAVEL_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+
+namespace Conceptrodon {
+namespace Typella {
+
+// Open the items packed in `Container`, at most `Levels` levels deep,
+// and collect the leaves into a `Capsule`.
+// Each node pastes the leaves of its items at once,
+// and the leaves are kept in `Capsule`s until the end.
+template<template<typename...> class Container>
+struct Ravel
+{
+    template<size_t, typename Item>
+    struct Detail
+    { using type = Capsule<Item>; };
+
+    template<size_t Levels, typename...Items>
+    requires (0 < Levels)
+    struct Detail<Levels, Container<Items...>>
+    {
+        using type = Cotanivore::TypicalPaste
+        <Capsule<>, typename Detail<Levels - 1, Items>::type...>::type;
+    };
+};
+
+}}
+
+#endif
@@ -0,0 +1,25 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELLA_SIGNIFY_H
+#define CONCEPTRODON_TYPELLA_SIGNIFY_H
+
+#include <string_view>
+
+namespace Conceptrodon {
+namespace Typella {
+
+// The signature of this function contains the name of `Element`.
+template<typename Element>
+consteval auto signify() -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+}}
+
+#endif
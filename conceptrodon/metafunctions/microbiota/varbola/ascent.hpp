@@ -0,0 +1,44 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_ASCENT_H
+#define CONCEPTRODON_VARBOLA_ASCENT_H
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include "conceptrodon/metafunctions/microbiota/varbola/conformable.hpp"
+
+namespace Conceptrodon {
+namespace Varbola {
+
+// A sorted list of variables materialized as an array.
+// Searches take the array by reference,
+// so a query is instantiated without the variables of the list.
+// The variables are converted to their common type,
+// so that lists mixing types such as `int` and `long` are accepted.
+// A variable whose value changes in the conversion, such as `-1` among unsigned variables, is rejected.
+template<auto...Variables>
+struct Ascent
+{
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    static constexpr std::array<value_type, sizeof...(Variables)> value
+    {static_cast<value_type>(Variables)...};
+
+    static_assert
+    (
+        std::ranges::is_sorted(value),
+        "Conceptrodon::Varybivore: variables must be sorted in ascending order."
+    );
+};
+
+}}
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_BINARY_SEARCH_H
+#define CONCEPTRODON_VARBOLA_BINARY_SEARCH_H
+
+#include <algorithm>
+#include <type_traits>
+#include "conceptrodon/metafunctions/microbiota/varbola/conformable.hpp"
+
+namespace Conceptrodon {
+namespace Varbola {
+
+template<auto const& Table>
+struct BinarySearch
+{
+    template<auto Inspecting>
+    struct ProtoPage
+    {
+        using value_type = std::remove_cvref_t<decltype(Table)>::value_type;
+
+        static_assert
+        (
+            conformable<value_type>(Inspecting),
+            "Conceptrodon::Varybivore: the target must keep its value in the type of the variables."
+        );
+
+        static constexpr bool value
+        {std::ranges::binary_search(Table, static_cast<value_type>(Inspecting))};
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Inspecting>
+    static constexpr bool Page_v {ProtoPage<Inspecting>::value};
+};
+
+}}
+
+#endif
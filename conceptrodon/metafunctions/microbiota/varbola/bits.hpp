@@ -0,0 +1,122 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_BITS_H
+#define CONCEPTRODON_VARBOLA_BITS_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Conceptrodon {
+namespace Varbola {
+
+// A structural bitset of `Length` bits stored in 64-bit words.
+// Bit `i` lives in `words[i / 64]` at position `i % 64`.
+// Bits past `Length` are always zero.
+template<size_t Length>
+struct Bits
+{
+    static constexpr size_t length {Length};
+    static constexpr size_t width {64};
+    static constexpr size_t size {(Length + width - 1) / width};
+
+    std::array<uint64_t, size> words {};
+
+    // Mask of the valid bits of the word at `index`.
+    static constexpr auto mask(size_t index) -> uint64_t
+    {
+        if (index + 1 < size || Length % width == 0)
+        { return ~uint64_t {0}; }
+        return (uint64_t {1} << (Length % width)) - 1;
+    }
+
+    constexpr auto test(size_t index) const -> bool
+    { return (words[index / width] >> (index % width)) & 1; }
+
+    constexpr auto operator&(Bits const& other) const -> Bits
+    {
+        Bits result {};
+        for (size_t i {0}; i < size; i++)
+        { result.words[i] = words[i] & other.words[i]; }
+        return result;
+    }
+
+    constexpr auto operator|(Bits const& other) const -> Bits
+    {
+        Bits result {};
+        for (size_t i {0}; i < size; i++)
+        { result.words[i] = words[i] | other.words[i]; }
+        return result;
+    }
+
+    constexpr auto operator~() const -> Bits
+    {
+        Bits result {};
+        for (size_t i {0}; i < size; i++)
+        { result.words[i] = ~words[i] & mask(i); }
+        return result;
+    }
+
+    constexpr auto count() const -> size_t
+    {
+        size_t counter {0};
+        for (size_t i {0}; i < size; i++)
+        { counter += std::popcount(words[i]); }
+        return counter;
+    }
+
+    // Index of the first set bit, or -1 if no bit is set.
+    constexpr auto first() const -> std::make_signed_t<size_t>
+    {
+        for (size_t i {0}; i < size; i++)
+        {
+            if (words[i] != 0)
+            { return i * width + std::countr_zero(words[i]); }
+        }
+        return -1;
+    }
+
+    constexpr auto all() const -> bool
+    {
+        for (size_t i {0}; i < size; i++)
+        {
+            if (words[i] != mask(i))
+            { return false; }
+        }
+        return true;
+    }
+
+    constexpr auto any() const -> bool
+    {
+        for (size_t i {0}; i < size; i++)
+        {
+            if (words[i] != 0)
+            { return true; }
+        }
+        return false;
+    }
+
+    constexpr auto operator==(Bits const&) const -> bool = default;
+};
+
+template<bool...Phenomena>
+consteval auto pack() -> Bits<sizeof...(Phenomena)>
+{
+    std::array<bool, sizeof...(Phenomena)> phenomena {Phenomena...};
+    Bits<sizeof...(Phenomena)> result {};
+
+    for (size_t i {0}; i < sizeof...(Phenomena); i++)
+    {
+        if (phenomena[i])
+        { result.words[i / 64] |= uint64_t {1} << (i % 64); }
+    }
+
+    return result;
+}
+
+}}
+
+#endif
@@ -0,0 +1,32 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_CONFORMABLE_H
+#define CONCEPTRODON_VARBOLA_CONFORMABLE_H
+
+#include <type_traits>
+
+namespace Conceptrodon {
+namespace Varbola {
+
+// `conformable<Type>(variable)` is true if `variable` keeps its value and its sign
+// after it is converted to `Type`.
+// Materialized lists convert their variables to a common type.
+// Mixing signed and unsigned types would otherwise turn `-1` into a large unsigned value.
+// Only conversions between integral types are checked.
+template<typename Type, typename Variable>
+constexpr bool conformable(Variable variable)
+{
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Variable>)
+    {
+        return static_cast<Variable>(static_cast<Type>(variable)) == variable
+        && (static_cast<Type>(variable) < Type{}) == (variable < Variable{});
+    }
+
+    else
+    { return true; }
+}
+
+}}
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_EQUAL_RANGE_H
+#define CONCEPTRODON_VARBOLA_EQUAL_RANGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/conformable.hpp"
+
+namespace Conceptrodon {
+namespace Varbola {
+
+template<auto const& Table>
+struct EqualRange
+{
+    template<auto Target>
+    struct ProtoPage
+    {
+        using value_type = std::remove_cvref_t<decltype(Table)>::value_type;
+
+        static_assert
+        (
+            conformable<value_type>(Target),
+            "Conceptrodon::Varybivore: the target must keep its value in the type of the variables."
+        );
+
+        static constexpr auto range
+        {std::ranges::equal_range(Table, static_cast<value_type>(Target))};
+
+        // The indices can be handed to `Slice` through `Rail`.
+        using type = Shuttle
+        <
+            static_cast<size_t>(range.begin() - Table.begin()),
+            static_cast<size_t>(range.end() - Table.begin())
+        >;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
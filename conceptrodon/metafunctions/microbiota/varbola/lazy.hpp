@@ -0,0 +1,155 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_LAZY_H
+#define CONCEPTRODON_VARBOLA_LAZY_H
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace Conceptrodon {
+namespace Varbola {
+
+template<typename Origin, size_t Start, size_t End>
+struct Sliced;
+
+template<typename Origin, size_t Start, size_t End>
+struct Expunged;
+
+template<typename Origin, size_t Amount>
+struct Swiveled;
+
+template<typename Origin>
+struct Reversed;
+
+template<typename Origin, template<auto...> class Device>
+struct Gauged;
+
+// `Lazy` equips a symbolic value sequence with list operations.
+// `Origin` derives from `Lazy<Origin>` and provides `size()` and `Among_v`.
+// Every operation returns another symbolic sequence in constant time.
+// Variables are only generated when the sequence is handed to `Rail`.
+template<typename Origin>
+struct Lazy
+{
+    template<size_t Index>
+    requires (Index < Origin::size())
+    struct Among
+    { static constexpr auto value {Origin::template Among_v<Index>}; };
+
+    template<size_t...>
+    struct ProtoSlice {};
+
+    template<size_t Amount>
+    requires (Amount <= Origin::size())
+    struct ProtoSlice<Amount>
+    { using type = Sliced<Origin, Amount, Origin::size()>; };
+
+    template<size_t Start, size_t End>
+    requires (Start <= End && End <= Origin::size())
+    struct ProtoSlice<Start, End>
+    { using type = Sliced<Origin, Start, End>; };
+
+    template<size_t...Agreements>
+    using Slice = ProtoSlice<Agreements...>::type;
+
+    template<size_t...>
+    struct ProtoErase {};
+
+    template<size_t Index>
+    requires (Index < Origin::size())
+    struct ProtoErase<Index>
+    { using type = Expunged<Origin, Index, Index + 1>; };
+
+    template<size_t Start, size_t End>
+    requires (Start <= End && End <= Origin::size())
+    struct ProtoErase<Start, End>
+    { using type = Expunged<Origin, Start, End>; };
+
+    template<size_t...Agreements>
+    using Erase = ProtoErase<Agreements...>::type;
+
+    template<size_t Amount>
+    requires (Amount <= Origin::size())
+    using Rotate = Swiveled<Origin, Amount>;
+
+    using TurnOver = Reversed<Origin>;
+
+    template<template<auto...> class Device>
+    using Gauge = Gauged<Origin, Device>;
+
+    template<typename, template<auto...> class>
+    struct Detail {};
+
+    template<size_t...I, template<auto...> class Operation>
+    struct Detail<std::index_sequence<I...>, Operation>
+    { using type = Operation<Origin::template Among_v<I>...>; };
+
+    template<template<auto...> class Operation>
+    struct ProtoRail
+    { using type = Detail<std::make_index_sequence<Origin::size()>, Operation>::type; };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>::type;
+
+    template<template<auto...> class Operation>
+    using UniRail = ProtoRail<Operation>::type;
+};
+
+template<typename Origin, size_t Start, size_t End>
+struct Sliced: public Lazy<Sliced<Origin, Start, End>>
+{
+    static constexpr size_t size() { return End - Start; }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Origin::template Among_v<Start + Index>};
+};
+
+template<typename Origin, size_t Start, size_t End>
+struct Expunged: public Lazy<Expunged<Origin, Start, End>>
+{
+    static constexpr size_t size() { return Origin::size() - (End - Start); }
+
+    template<size_t Index>
+    static constexpr auto Among_v
+    {Origin::template Among_v<(Index < Start ? Index : Index + (End - Start))>};
+};
+
+template<typename Origin, size_t Amount>
+struct Swiveled: public Lazy<Swiveled<Origin, Amount>>
+{
+    static constexpr size_t size() { return Origin::size(); }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Origin::template Among_v<(Index + Amount) % Origin::size()>};
+};
+
+template<typename Origin>
+struct Reversed: public Lazy<Reversed<Origin>>
+{
+    static constexpr size_t size() { return Origin::size(); }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Origin::template Among_v<Origin::size() - 1 - Index>};
+};
+
+template<typename Origin, template<auto...> class Device>
+struct Gauged: public Lazy<Gauged<Origin, Device>>
+{
+    static constexpr size_t size() { return Origin::size(); }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Device<Origin::template Among_v<Index>>::value};
+};
+
+
+// `Symbolic<Target>` is true if `Target` is a symbolic sequence built on `Lazy`.
+// The member check keeps incomplete types away from `std::derived_from`.
+template<typename Target>
+concept Symbolic = requires { typename Target::TurnOver; }
+&& std::derived_from<Target, Lazy<Target>>;
+
+}}
+
+#endif
@@ -0,0 +1,33 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_SPREAD_H
+#define CONCEPTRODON_VARBOLA_SPREAD_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/shuttle.hpp"
+
+namespace Conceptrodon {
+namespace Varbola {
+
+// `Spread` presents a symbolic sequence through the members of `Omennivore::Kind`.
+// The template arguments of `Target` are not its variables,
+// so the variables are generated by `UniRail`.
+// New variables need not follow `Target`, so they are packed into a `Shuttle`.
+template<typename Target>
+struct Spread
+{
+    static constexpr size_t size {Target::size()};
+
+    using type = Target::template UniRail<Shuttle>;
+
+    template<typename Operation>
+    using Relay = Target::template UniRail<Operation::template Page>;
+
+    template<auto...Agreements>
+    using Page = Shuttle<Agreements...>;
+};
+
+}}
+
+#endif
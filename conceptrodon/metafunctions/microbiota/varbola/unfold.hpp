@@ -0,0 +1,25 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_UNFOLD_H
+#define CONCEPTRODON_VARBOLA_UNFOLD_H
+
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+
+namespace Conceptrodon {
+namespace Varbola {
+
+template<auto const&, typename>
+struct Unfold {};
+
+// The variables are read through a reference,
+// so the expansion is instantiated without the pack of the caller.
+template<auto const& Table, size_t...I>
+struct Unfold<Table, std::index_sequence<I...>>
+{ using type = Shuttle<Table[I]...>; };
+
+}}
+
+#endif
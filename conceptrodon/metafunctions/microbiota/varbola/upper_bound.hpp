@@ -0,0 +1,42 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARBOLA_UPPER_BOUND_H
+#define CONCEPTRODON_VARBOLA_UPPER_BOUND_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include "conceptrodon/metafunctions/microbiota/varbola/conformable.hpp"
+
+namespace Conceptrodon {
+namespace Varbola {
+
+template<auto const& Table>
+struct UpperBound
+{
+    template<auto Target>
+    struct ProtoPage
+    {
+        using value_type = std::remove_cvref_t<decltype(Table)>::value_type;
+
+        static_assert
+        (
+            conformable<value_type>(Target),
+            "Conceptrodon::Varybivore: the target must keep its value in the type of the variables."
+        );
+
+        static constexpr size_t value
+        {static_cast<size_t>(std::ranges::upper_bound(Table, static_cast<value_type>(Target)) - Table.begin())};
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Target>
+    static constexpr size_t Page_v {ProtoPage<Target>::value};
+};
+
+}}
+
+#endif
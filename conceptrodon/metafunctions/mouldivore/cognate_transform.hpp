@@ -53,6 +53,10 @@ struct CognateTransform
 
                 template<typename...Elements>
                 using Mold = Operation<typename Detail<Elements>::type...>;
+
+                // `Mouldivore::Streamline` fuses adjacent transformations through `Assemble`.
+                template<template<template<typename...> class, template<typename> class...> class Agent>
+                using Assemble = Agent<Operation, Detail>;
             };
         };
 
@@ -7,14 +7,35 @@
 namespace Conceptrodon {
 namespace Mouldivore {
 
-template <template<typename...> class...Predicates>
+template<template<typename...> class...Predicates>
 struct Conjunction
 {
+    // Predicates are instantiated one at a time.
+    // The evaluation stops at the first predicate that settles the result.
     template<typename...Elements>
     struct ProtoMold
     {
-        static constexpr bool value 
-        {(...&&Predicates<Elements...>::value)};
+        template<template<typename...> class...>
+        struct Detail
+        { static constexpr bool value {true}; };
+
+        template<template<typename...> class First, template<typename...> class...Others>
+        struct Detail<First, Others...>
+        {
+            static constexpr bool value
+            {
+                []()
+                {
+                    if constexpr (not First<Elements...>::value)
+                    { return false; }
+                    else
+                    { return Detail<Others...>::value; }
+                }()
+            };
+        };
+
+        static constexpr bool value
+        {Detail<Predicates...>::value};
     };
 
     template<typename...Elements>
@@ -22,10 +43,9 @@ struct Conjunction
 
     template<typename...Elements>
     static constexpr bool Mold_v
-    {(...&&Predicates<Elements...>::value)};
+    {ProtoMold<Elements...>::value};
 };
 
-
 }}
 
-#endif
\ No newline at end of file
+#endif
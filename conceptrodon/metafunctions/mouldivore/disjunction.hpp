@@ -7,14 +7,35 @@
 namespace Conceptrodon {
 namespace Mouldivore {
 
-template <template<typename...> class...Predicates>
+template<template<typename...> class...Predicates>
 struct Disjunction
 {
+    // Predicates are instantiated one at a time.
+    // The evaluation stops at the first predicate that settles the result.
     template<typename...Elements>
     struct ProtoMold
     {
+        template<template<typename...> class...>
+        struct Detail
+        { static constexpr bool value {false}; };
+
+        template<template<typename...> class First, template<typename...> class...Others>
+        struct Detail<First, Others...>
+        {
+            static constexpr bool value
+            {
+                []()
+                {
+                    if constexpr (static_cast<bool>(First<Elements...>::value))
+                    { return true; }
+                    else
+                    { return Detail<Others...>::value; }
+                }()
+            };
+        };
+
         static constexpr bool value
-        {(...||Predicates<Elements...>::value)};
+        {Detail<Predicates...>::value};
     };
 
     template<typename...Elements>
@@ -22,9 +43,9 @@ struct Disjunction
 
     template<typename...Elements>
     static constexpr bool Mold_v
-    {(...||Predicates<Elements...>::value)};
+    {ProtoMold<Elements...>::value};
 };
 
 }}
 
-#endif
\ No newline at end of file
+#endif
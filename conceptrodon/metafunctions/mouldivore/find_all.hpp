@@ -0,0 +1,29 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_FIND_ALL_H
+#define CONCEPTRODON_MOULDIVORE_FIND_ALL_H
+
+#include "conceptrodon/metafunctions/typelivore/kindred_find_all.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+
+template<template<typename...> class...Predicates>
+struct FindAll
+{
+    template<typename...Elements>
+    using Mold = Typelivore::KindredFindAll<Elements...>
+    ::template Road<Predicates...>;
+
+    template<typename...Elements>
+    static constexpr auto Mold_v
+    {
+        Typelivore::KindredFindAll<Elements...>
+        ::template Road_v<Predicates...>
+    };
+};
+
+}}
+
+#endif
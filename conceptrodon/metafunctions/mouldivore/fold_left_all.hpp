@@ -0,0 +1,30 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_FOLD_LEFT_ALL_H
+#define CONCEPTRODON_MOULDIVORE_FOLD_LEFT_ALL_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/ledger.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+
+template<template<typename...> class Operation>
+struct FoldLeftAll
+{
+    template<typename Initiator>
+    struct ProtoMold
+    {
+        template<typename...Elements>
+        using Mold = Typella::Ledger<Operation>
+        ::template Detail<Capsule<>, Initiator, Elements...>::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+}}
+
+#endif
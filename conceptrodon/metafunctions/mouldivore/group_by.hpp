@@ -0,0 +1,22 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_GROUP_BY_H
+#define CONCEPTRODON_MOULDIVORE_GROUP_BY_H
+
+#include "conceptrodon/metafunctions/typelivore/group_by.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+
+template<template<typename...> class KeyExtractor>
+struct GroupBy
+{
+    template<typename...Elements>
+    using Mold = Typelivore::GroupBy<Elements...>
+    ::template Road<KeyExtractor>;
+};
+
+}}
+
+#endif
@@ -6,44 +6,49 @@
 
 #include <cstddef>
 #include <type_traits>
+#include "conceptrodon/metafunctions/microbiota/typella/kindred_find.hpp"
 
 namespace Conceptrodon {
 namespace Mouldivore {
 
+// The elements are examined in blocks.
+// A block is only instantiated if the previous ones contain no match.
 template<template<typename...> class Predicate>
 struct LookFor
 {
+    // Without elements, there is nothing to find.
     template<typename...Elements>
-    struct ProtoMold
+    struct Detail
+    { using type = std::integral_constant<std::make_signed_t<size_t>, -1>; };
+
+    template<typename...Elements>
+    requires (sizeof...(Elements) != 0)
+    struct Detail<Elements...>
     {
-        static constexpr auto value
-        {
-            []() -> std::make_signed_t<size_t>
-            {
-                std::make_signed_t<size_t> counter {0};
-                return
-                (...||( (++counter, Predicate<Elements>::value) ? true : false)) ? 
-                counter : -1;
-            }()
-        };
+        using type = Typella::KindredFind<Elements...>
+        ::template ProtoRoad<Predicate>;
     };
 
     template<typename...Elements>
-    using Mold = ProtoMold<Elements...>;
+    using Mold = Detail<Elements...>::type;
 
     template<typename...Elements>
-    static constexpr auto Mold_v
+    static constexpr std::make_signed_t<size_t> Mold_v
     {
         []() -> std::make_signed_t<size_t>
         {
-            std::make_signed_t<size_t> counter {-1};
-            return
-            (...||( (++counter, Predicate<Elements>::value) ? true : false)) ? 
-            counter : -1;
+            if constexpr (sizeof...(Elements) == 0)
+            { return -1; }
+
+            else
+            {
+                return Typella::KindredFind<Elements...>
+                ::template Road_v<Predicate>;
+            }
         }()
     };
 };
 
 }}
 
-#endif
\ No newline at end of file
+#endif
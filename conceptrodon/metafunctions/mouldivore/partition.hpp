@@ -0,0 +1,22 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_PARTITION_H
+#define CONCEPTRODON_MOULDIVORE_PARTITION_H
+
+#include "conceptrodon/metafunctions/typelivore/partition.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+
+template<template<typename...> class...Predicates>
+struct Partition
+{
+    template<typename...Elements>
+    using Mold = Typelivore::Partition<Elements...>
+    ::template Road<Predicates...>;
+};
+
+}}
+
+#endif
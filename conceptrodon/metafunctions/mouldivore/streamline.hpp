@@ -0,0 +1,24 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_STREAMLINE_H
+#define CONCEPTRODON_MOULDIVORE_STREAMLINE_H
+
+#include "conceptrodon/metafunctions/microbiota/moldiae/peephole.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+
+template<typename First, typename...Others>
+struct Streamline
+{
+    using type = Moldiae::Peephole<First, Others...>::type;
+
+    template<typename...Elements>
+    using Mold = type::template UniRoad<Moldiae::Travel>
+    ::template Mold<Elements...>;
+};
+
+}}
+
+#endif
@@ -4,179 +4,171 @@
 #ifndef CONCEPTRODON_OMENNIVORE_EXTEND_BACK_H
 #define CONCEPTRODON_OMENNIVORE_EXTEND_BACK_H
 
-namespace Conceptrodon {
-namespace Omennivore {
-
-template<typename>
-struct ExtendBack {};
-
-template
-<
-    template<typename...> class Container,
-    typename...PreexistingElements
->
-struct ExtendBack<Container<PreexistingElements...>>
-{
-    template<typename...NewElements>
-    using Mold = Container<PreexistingElements..., NewElements...>;
-};
-
-template
-<
-    template<auto...> class Sequence,
-    auto...PreexistingVariables
->
-struct ExtendBack<Sequence<PreexistingVariables...>>
-{
-    template<auto...NewVariables>
-    using Page = Sequence<PreexistingVariables..., NewVariables...>;
-};
-
-template
-<
-    template<typename, auto...> class Sequence,
-    typename Type,
-    auto...PreexistingVariables
->
-struct ExtendBack<Sequence<Type, PreexistingVariables...>>
-{
-    template<auto...NewVariables>
-    using Page = Sequence<Type, PreexistingVariables..., static_cast<Type>(NewVariables)...>;
-};
-
-template
-<
-    template<template<typename...> class...> class Warehouse,
-    template<typename...> class...PreexistingContainers
->
-struct ExtendBack<Warehouse<PreexistingContainers...>>
-{
-    template<template<typename...> class...NewContainers>
-    using Road = Warehouse<PreexistingContainers..., NewContainers...>;
-};
-
-template
-<
-    template<template<auto...> class...> class Stockroom,
-    template<auto...> class...PreexistingSequences
->
-struct ExtendBack<Stockroom<PreexistingSequences...>>
-{
-    template<template<auto...> class...NewSequences>
-    using Rail = Stockroom<PreexistingSequences..., NewSequences...>;
-};
-
-template
-<
-    template<template<template<typename...> class...> class...> class Sorrow,
-    template<template<typename...> class...> class...PreexistingWarehouses
->
-struct ExtendBack<Sorrow<PreexistingWarehouses...>>
-{
-    template<template<template<typename...> class...> class...NewWarehouses>
-    using Flow = Sorrow<PreexistingWarehouses..., NewWarehouses...>;
-};
-
-template
-<
-    template<template<template<auto...> class...> class...> class Melancholy,
-    template<template<auto...> class...> class...PreexistingStockrooms
->
-struct ExtendBack<Melancholy<PreexistingStockrooms...>>
-{
-    template<template<template<auto...> class...> class...NewStockrooms>
-    using Sail = Melancholy<PreexistingStockrooms..., NewStockrooms...>;
-};
-
-template
-<
-    template<template<template<template<typename...> class...> class...> class...> class Silence,
-    template<template<template<typename...> class...> class...> class...PreexistingSorrow
->
-struct ExtendBack<Silence<PreexistingSorrow...>>
-{
-    template<template<template<template<typename...> class...> class...> class...NewSorrow>
-    using Snow = Silence<PreexistingSorrow..., NewSorrow...>;
-};
-
-template
-<
-    template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-    template<template<template<auto...> class...> class...> class...PreexistingMelancholy
->
-struct ExtendBack<Tranquil<PreexistingMelancholy...>>
-{
-    template<template<template<template<auto...> class...> class...> class...NewMelancholy>
-    using Hail = Tranquil<PreexistingMelancholy..., NewMelancholy...>;
-};
-
-template
-<
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-    template<template<template<template<typename...> class...> class...> class...> class...PreexistingSilence
->
-struct ExtendBack<Consistency<PreexistingSilence...>>
-{
-    template<template<template<template<template<typename...> class...> class...> class...> class...NewSilence>
-    using Cool = Consistency<PreexistingSilence..., NewSilence...>;
-};
-
-template
-<
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
-    template<template<template<template<auto...> class...> class...> class...> class...PreexistingTranquil
->
-struct ExtendBack<Perseverance<PreexistingTranquil...>>
-{
-    template<template<template<template<template<auto...> class...> class...> class...> class...NewTranquil>
-    using Calm = Perseverance<PreexistingTranquil..., NewTranquil...>;
-};
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
 
-template
-<
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class...PreexistingConsistency
->
-struct ExtendBack<Sunshine<PreexistingConsistency...>>
+namespace Conceptrodon {
+namespace Ominuci {
+
+// `Kind<Target>::Relay` invokes the member named after the shape of `Target`
+// with the preexisting arguments.
+// The result appends new arguments through the rebuild alias of `Vessel`,
+// which is `Kind<Target>`.
+template<typename Vessel>
+struct Append
 {
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...NewConsistency>
-    using Grit = Sunshine<PreexistingConsistency..., NewConsistency...>;
+    template<typename...PreexistingElements>
+    struct ProtoMold
+    {
+        template<typename...NewElements>
+        using Mold = Vessel::template Mold<PreexistingElements..., NewElements...>;
+    };
+
+    template<typename...PreexistingElements>
+    using Mold = ProtoMold<PreexistingElements...>;
+
+    template<auto...PreexistingVariables>
+    struct ProtoPage
+    {
+        template<auto...NewVariables>
+        using Page = Vessel::template Page<PreexistingVariables..., NewVariables...>;
+    };
+
+    template<auto...PreexistingVariables>
+    using Page = ProtoPage<PreexistingVariables...>;
+
+    template<template<typename...> class...PreexistingContainers>
+    struct ProtoRoad
+    {
+        template<template<typename...> class...NewContainers>
+        using Road = Vessel::template Road<PreexistingContainers..., NewContainers...>;
+    };
+
+    template<template<typename...> class...PreexistingContainers>
+    using Road = ProtoRoad<PreexistingContainers...>;
+
+    template<template<auto...> class...PreexistingSequences>
+    struct ProtoRail
+    {
+        template<template<auto...> class...NewSequences>
+        using Rail = Vessel::template Rail<PreexistingSequences..., NewSequences...>;
+    };
+
+    template<template<auto...> class...PreexistingSequences>
+    using Rail = ProtoRail<PreexistingSequences...>;
+
+    template<template<template<typename...> class...> class...PreexistingWarehouses>
+    struct ProtoFlow
+    {
+        template<template<template<typename...> class...> class...NewWarehouses>
+        using Flow = Vessel::template Flow<PreexistingWarehouses..., NewWarehouses...>;
+    };
+
+    template<template<template<typename...> class...> class...PreexistingWarehouses>
+    using Flow = ProtoFlow<PreexistingWarehouses...>;
+
+    template<template<template<auto...> class...> class...PreexistingStockrooms>
+    struct ProtoSail
+    {
+        template<template<template<auto...> class...> class...NewStockrooms>
+        using Sail = Vessel::template Sail<PreexistingStockrooms..., NewStockrooms...>;
+    };
+
+    template<template<template<auto...> class...> class...PreexistingStockrooms>
+    using Sail = ProtoSail<PreexistingStockrooms...>;
+
+    template<template<template<template<typename...> class...> class...> class...PreexistingSorrow>
+    struct ProtoSnow
+    {
+        template<template<template<template<typename...> class...> class...> class...NewSorrow>
+        using Snow = Vessel::template Snow<PreexistingSorrow..., NewSorrow...>;
+    };
+
+    template<template<template<template<typename...> class...> class...> class...PreexistingSorrow>
+    using Snow = ProtoSnow<PreexistingSorrow...>;
+
+    template<template<template<template<auto...> class...> class...> class...PreexistingMelancholy>
+    struct ProtoHail
+    {
+        template<template<template<template<auto...> class...> class...> class...NewMelancholy>
+        using Hail = Vessel::template Hail<PreexistingMelancholy..., NewMelancholy...>;
+    };
+
+    template<template<template<template<auto...> class...> class...> class...PreexistingMelancholy>
+    using Hail = ProtoHail<PreexistingMelancholy...>;
+
+    template<template<template<template<template<typename...> class...> class...> class...> class...PreexistingSilence>
+    struct ProtoCool
+    {
+        template<template<template<template<template<typename...> class...> class...> class...> class...NewSilence>
+        using Cool = Vessel::template Cool<PreexistingSilence..., NewSilence...>;
+    };
+
+    template<template<template<template<template<typename...> class...> class...> class...> class...PreexistingSilence>
+    using Cool = ProtoCool<PreexistingSilence...>;
+
+    template<template<template<template<template<auto...> class...> class...> class...> class...PreexistingTranquil>
+    struct ProtoCalm
+    {
+        template<template<template<template<template<auto...> class...> class...> class...> class...NewTranquil>
+        using Calm = Vessel::template Calm<PreexistingTranquil..., NewTranquil...>;
+    };
+
+    template<template<template<template<template<auto...> class...> class...> class...> class...PreexistingTranquil>
+    using Calm = ProtoCalm<PreexistingTranquil...>;
+
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...PreexistingConsistency>
+    struct ProtoGrit
+    {
+        template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...NewConsistency>
+        using Grit = Vessel::template Grit<PreexistingConsistency..., NewConsistency...>;
+    };
+
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...PreexistingConsistency>
+    using Grit = ProtoGrit<PreexistingConsistency...>;
+
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...PreexistingPerseverance>
+    struct ProtoWill
+    {
+        template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...NewPerseverance>
+        using Will = Vessel::template Will<PreexistingPerseverance..., NewPerseverance...>;
+    };
+
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...PreexistingPerseverance>
+    using Will = ProtoWill<PreexistingPerseverance...>;
+
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    struct ProtoGlow
+    {
+        template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...NewSunshines>
+        using Glow = Vessel::template Glow<PreexistingSunshines..., NewSunshines...>;
+    };
+
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    using Glow = ProtoGlow<PreexistingSunshines...>;
+
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    struct ProtoDawn
+    {
+        template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...NewSunshines>
+        using Dawn = Vessel::template Dawn<PreexistingSunshines..., NewSunshines...>;
+    };
+
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    using Dawn = ProtoDawn<PreexistingSunshines...>;
 };
 
-template
-<
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class...PreexistingPerseverance
->
-struct ExtendBack<Sunshine<PreexistingPerseverance...>>
-{
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...NewPerseverance>
-    using Will = Sunshine<PreexistingPerseverance..., NewPerseverance...>;
-};
+}
 
-template
-<
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...PreexistingSunshines
->
-struct ExtendBack<Sunlight<PreexistingSunshines...>>
-{
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...NewSunshines>
-    using Glow = Sunlight<PreexistingSunshines..., NewSunshines...>;
-};
+namespace Omennivore {
 
-template
-<
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...PreexistingSunshines
->
-struct ExtendBack<Sunlight<PreexistingSunshines...>>
-{
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...NewSunshines>
-    using Dawn = Sunlight<PreexistingSunshines..., NewSunshines...>;
-};
+template<typename>
+struct ExtendBack {};
 
+template<typename Target>
+requires (Kind<Target>::value != Kinds::Unknown)
+struct ExtendBack<Target>
+: public Kind<Target>::template Relay<Ominuci::Append<Kind<Target>>> {};
 
 }}
 
-#endif
\ No newline at end of file
+#endif
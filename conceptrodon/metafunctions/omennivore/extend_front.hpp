@@ -4,179 +4,171 @@
 #ifndef CONCEPTRODON_OMENNIVORE_EXTEND_FRONT_H
 #define CONCEPTRODON_OMENNIVORE_EXTEND_FRONT_H
 
-namespace Conceptrodon {
-namespace Omennivore {
-
-template<typename>
-struct ExtendFront {};
-
-template
-<
-    template<typename...> class Container,
-    typename...PreexistingElements
->
-struct ExtendFront<Container<PreexistingElements...>>
-{
-    template<typename...NewElements>
-    using Mold = Container<NewElements..., PreexistingElements...>;
-};
-
-template
-<
-    template<auto...> class Sequence,
-    auto...PreexistingVariables
->
-struct ExtendFront<Sequence<PreexistingVariables...>>
-{
-    template<auto...NewVariables>
-    using Page = Sequence<NewVariables..., PreexistingVariables...>;
-};
-
-template
-<
-    template<typename, auto...> class Sequence,
-    typename Type,
-    auto...PreexistingVariables
->
-struct ExtendFront<Sequence<Type, PreexistingVariables...>>
-{
-    template<auto...NewVariables>
-    using Page = Sequence<Type, static_cast<Type>(NewVariables)..., PreexistingVariables...>;
-};
-
-template
-<
-    template<template<typename...> class...> class Warehouse,
-    template<typename...> class...PreexistingContainers
->
-struct ExtendFront<Warehouse<PreexistingContainers...>>
-{
-    template<template<typename...> class...NewContainers>
-    using Road = Warehouse<NewContainers..., PreexistingContainers...>;
-};
-
-template
-<
-    template<template<auto...> class...> class Stockroom,
-    template<auto...> class...PreexistingSequences
->
-struct ExtendFront<Stockroom<PreexistingSequences...>>
-{
-    template<template<auto...> class...NewSequences>
-    using Rail = Stockroom<NewSequences..., PreexistingSequences...>;
-};
-
-template
-<
-    template<template<template<typename...> class...> class...> class Sorrow,
-    template<template<typename...> class...> class...PreexistingWarehouses
->
-struct ExtendFront<Sorrow<PreexistingWarehouses...>>
-{
-    template<template<template<typename...> class...> class...NewWarehouses>
-    using Flow = Sorrow<NewWarehouses..., PreexistingWarehouses...>;
-};
-
-template
-<
-    template<template<template<auto...> class...> class...> class Melancholy,
-    template<template<auto...> class...> class...PreexistingStockrooms
->
-struct ExtendFront<Melancholy<PreexistingStockrooms...>>
-{
-    template<template<template<auto...> class...> class...NewStockrooms>
-    using Sail = Melancholy<NewStockrooms..., PreexistingStockrooms...>;
-};
-
-template
-<
-    template<template<template<template<typename...> class...> class...> class...> class Silence,
-    template<template<template<typename...> class...> class...> class...PreexistingSorrow
->
-struct ExtendFront<Silence<PreexistingSorrow...>>
-{
-    template<template<template<template<typename...> class...> class...> class...NewSorrow>
-    using Snow = Silence<NewSorrow..., PreexistingSorrow...>;
-};
-
-template
-<
-    template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-    template<template<template<auto...> class...> class...> class...PreexistingMelancholy
->
-struct ExtendFront<Tranquil<PreexistingMelancholy...>>
-{
-    template<template<template<template<auto...> class...> class...> class...NewMelancholy>
-    using Hail = Tranquil<NewMelancholy..., PreexistingMelancholy...>;
-};
-
-template
-<
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-    template<template<template<template<typename...> class...> class...> class...> class...PreexistingSilence
->
-struct ExtendFront<Consistency<PreexistingSilence...>>
-{
-    template<template<template<template<template<typename...> class...> class...> class...> class...NewSilence>
-    using Cool = Consistency<NewSilence..., PreexistingSilence...>;
-};
-
-template
-<
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
-    template<template<template<template<auto...> class...> class...> class...> class...PreexistingTranquil
->
-struct ExtendFront<Perseverance<PreexistingTranquil...>>
-{
-    template<template<template<template<template<auto...> class...> class...> class...> class...NewTranquil>
-    using Calm = Perseverance<NewTranquil..., PreexistingTranquil...>;
-};
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
 
-template
-<
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class...PreexistingConsistency
->
-struct ExtendFront<Sunshine<PreexistingConsistency...>>
+namespace Conceptrodon {
+namespace Ominuci {
+
+// `Kind<Target>::Relay` invokes the member named after the shape of `Target`
+// with the preexisting arguments.
+// The result prepends new arguments through the rebuild alias of `Vessel`,
+// which is `Kind<Target>`.
+template<typename Vessel>
+struct Prepend
 {
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...NewConsistency>
-    using Grit = Sunshine<NewConsistency..., PreexistingConsistency...>;
+    template<typename...PreexistingElements>
+    struct ProtoMold
+    {
+        template<typename...NewElements>
+        using Mold = Vessel::template Mold<NewElements..., PreexistingElements...>;
+    };
+
+    template<typename...PreexistingElements>
+    using Mold = ProtoMold<PreexistingElements...>;
+
+    template<auto...PreexistingVariables>
+    struct ProtoPage
+    {
+        template<auto...NewVariables>
+        using Page = Vessel::template Page<NewVariables..., PreexistingVariables...>;
+    };
+
+    template<auto...PreexistingVariables>
+    using Page = ProtoPage<PreexistingVariables...>;
+
+    template<template<typename...> class...PreexistingContainers>
+    struct ProtoRoad
+    {
+        template<template<typename...> class...NewContainers>
+        using Road = Vessel::template Road<NewContainers..., PreexistingContainers...>;
+    };
+
+    template<template<typename...> class...PreexistingContainers>
+    using Road = ProtoRoad<PreexistingContainers...>;
+
+    template<template<auto...> class...PreexistingSequences>
+    struct ProtoRail
+    {
+        template<template<auto...> class...NewSequences>
+        using Rail = Vessel::template Rail<NewSequences..., PreexistingSequences...>;
+    };
+
+    template<template<auto...> class...PreexistingSequences>
+    using Rail = ProtoRail<PreexistingSequences...>;
+
+    template<template<template<typename...> class...> class...PreexistingWarehouses>
+    struct ProtoFlow
+    {
+        template<template<template<typename...> class...> class...NewWarehouses>
+        using Flow = Vessel::template Flow<NewWarehouses..., PreexistingWarehouses...>;
+    };
+
+    template<template<template<typename...> class...> class...PreexistingWarehouses>
+    using Flow = ProtoFlow<PreexistingWarehouses...>;
+
+    template<template<template<auto...> class...> class...PreexistingStockrooms>
+    struct ProtoSail
+    {
+        template<template<template<auto...> class...> class...NewStockrooms>
+        using Sail = Vessel::template Sail<NewStockrooms..., PreexistingStockrooms...>;
+    };
+
+    template<template<template<auto...> class...> class...PreexistingStockrooms>
+    using Sail = ProtoSail<PreexistingStockrooms...>;
+
+    template<template<template<template<typename...> class...> class...> class...PreexistingSorrow>
+    struct ProtoSnow
+    {
+        template<template<template<template<typename...> class...> class...> class...NewSorrow>
+        using Snow = Vessel::template Snow<NewSorrow..., PreexistingSorrow...>;
+    };
+
+    template<template<template<template<typename...> class...> class...> class...PreexistingSorrow>
+    using Snow = ProtoSnow<PreexistingSorrow...>;
+
+    template<template<template<template<auto...> class...> class...> class...PreexistingMelancholy>
+    struct ProtoHail
+    {
+        template<template<template<template<auto...> class...> class...> class...NewMelancholy>
+        using Hail = Vessel::template Hail<NewMelancholy..., PreexistingMelancholy...>;
+    };
+
+    template<template<template<template<auto...> class...> class...> class...PreexistingMelancholy>
+    using Hail = ProtoHail<PreexistingMelancholy...>;
+
+    template<template<template<template<template<typename...> class...> class...> class...> class...PreexistingSilence>
+    struct ProtoCool
+    {
+        template<template<template<template<template<typename...> class...> class...> class...> class...NewSilence>
+        using Cool = Vessel::template Cool<NewSilence..., PreexistingSilence...>;
+    };
+
+    template<template<template<template<template<typename...> class...> class...> class...> class...PreexistingSilence>
+    using Cool = ProtoCool<PreexistingSilence...>;
+
+    template<template<template<template<template<auto...> class...> class...> class...> class...PreexistingTranquil>
+    struct ProtoCalm
+    {
+        template<template<template<template<template<auto...> class...> class...> class...> class...NewTranquil>
+        using Calm = Vessel::template Calm<NewTranquil..., PreexistingTranquil...>;
+    };
+
+    template<template<template<template<template<auto...> class...> class...> class...> class...PreexistingTranquil>
+    using Calm = ProtoCalm<PreexistingTranquil...>;
+
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...PreexistingConsistency>
+    struct ProtoGrit
+    {
+        template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...NewConsistency>
+        using Grit = Vessel::template Grit<NewConsistency..., PreexistingConsistency...>;
+    };
+
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...PreexistingConsistency>
+    using Grit = ProtoGrit<PreexistingConsistency...>;
+
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...PreexistingPerseverance>
+    struct ProtoWill
+    {
+        template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...NewPerseverance>
+        using Will = Vessel::template Will<NewPerseverance..., PreexistingPerseverance...>;
+    };
+
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...PreexistingPerseverance>
+    using Will = ProtoWill<PreexistingPerseverance...>;
+
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    struct ProtoGlow
+    {
+        template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...NewSunshines>
+        using Glow = Vessel::template Glow<NewSunshines..., PreexistingSunshines...>;
+    };
+
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    using Glow = ProtoGlow<PreexistingSunshines...>;
+
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    struct ProtoDawn
+    {
+        template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...NewSunshines>
+        using Dawn = Vessel::template Dawn<NewSunshines..., PreexistingSunshines...>;
+    };
+
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...PreexistingSunshines>
+    using Dawn = ProtoDawn<PreexistingSunshines...>;
 };
 
-template
-<
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class...PreexistingPerseverance
->
-struct ExtendFront<Sunshine<PreexistingPerseverance...>>
-{
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...NewPerseverance>
-    using Will = Sunshine<NewPerseverance..., PreexistingPerseverance...>;
-};
+}
 
-template
-<
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...PreexistingSunshines
->
-struct ExtendFront<Sunlight<PreexistingSunshines...>>
-{
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...NewSunshines>
-    using Glow = Sunlight<NewSunshines..., PreexistingSunshines...>;
-};
+namespace Omennivore {
 
-template
-<
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...PreexistingSunshines
->
-struct ExtendFront<Sunlight<PreexistingSunshines...>>
-{
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...NewSunshines>
-    using Dawn = Sunlight<NewSunshines..., PreexistingSunshines...>;
-};
+template<typename>
+struct ExtendFront {};
 
+template<typename Target>
+requires (Kind<Target>::value != Kinds::Unknown)
+struct ExtendFront<Target>
+: public Kind<Target>::template Relay<Ominuci::Prepend<Kind<Target>>> {};
 
 }}
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,17 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_FLATTEN_H
+#define CONCEPTRODON_OMENNIVORE_FLATTEN_H
+
+#include "conceptrodon/metafunctions/omennivore/typical_flatten.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+
+template<typename Tree, auto...Depth>
+using Flatten = TypicalFlatten<Tree, Depth...>::type;
+
+}}
+
+#endif
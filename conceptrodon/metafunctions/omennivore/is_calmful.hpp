@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_CALMFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_CALMFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsCalmful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
-    template<template<template<template<auto...> class...> class...> class...> class...Tranquil
->
-struct IsCalmful<Perseverance<Tranquil...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsCalmful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Calm}; };
 
-template
-<
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
-    template<template<template<template<auto...> class...> class...> class...> class...Tranquil
->
-constexpr bool IsCalmful_v<Perseverance<Tranquil...>> {true};
+template<typename Target>
+constexpr bool IsCalmful_v {Kind<Target>::value == Kinds::Calm};
 
 }}
 
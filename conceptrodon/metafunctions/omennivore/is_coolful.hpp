@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_COOLFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_COOLFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsCoolful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-    template<template<template<template<typename...> class...> class...> class...> class...Silence
->
-struct IsCoolful<Consistency<Silence...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsCoolful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Cool}; };
 
-template
-<
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-    template<template<template<template<typename...> class...> class...> class...> class...Silence
->
-constexpr bool IsCoolful_v<Consistency<Silence...>> {true};
+template<typename Target>
+constexpr bool IsCoolful_v {Kind<Target>::value == Kinds::Cool};
 
 }}
 
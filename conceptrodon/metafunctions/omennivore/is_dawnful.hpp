@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_DAWNFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_DAWNFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsDawnful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Sunshines
->
-struct IsDawnful<Sunlight<Sunshines...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsDawnful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Dawn}; };
 
-template
-<
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Sunshines
->
-constexpr bool IsDawnful_v<Sunlight<Sunshines...>> {true};
+template<typename Target>
+constexpr bool IsDawnful_v {Kind<Target>::value == Kinds::Dawn};
 
 }}
 
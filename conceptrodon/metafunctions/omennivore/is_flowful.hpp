@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_FLOWFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_FLOWFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsFlowful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<typename...> class...> class...> class Sorrow,
-    template<template<typename...> class...> class...Warehouses
->
-struct IsFlowful<Sorrow<Warehouses...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsFlowful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Flow}; };
 
-template
-<
-    template<template<template<typename...> class...> class...> class Sorrow,
-    template<template<typename...> class...> class...Warehouses
->
-constexpr bool IsFlowful_v<Sorrow<Warehouses...>> {true};
+template<typename Target>
+constexpr bool IsFlowful_v {Kind<Target>::value == Kinds::Flow};
 
 }}
 
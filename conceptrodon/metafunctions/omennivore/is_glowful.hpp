@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_GLOWFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_GLOWFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsGlowful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Sunshines
->
-struct IsGlowful<Sunlight<Sunshines...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsGlowful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Glow}; };
 
-template
-<
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Sunshines
->
-constexpr bool IsGlowful_v<Sunlight<Sunshines...>> {true};
+template<typename Target>
+constexpr bool IsGlowful_v {Kind<Target>::value == Kinds::Glow};
 
 }}
 
@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_GRITFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_GRITFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsGritful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class...Consistency
->
-struct IsGritful<Sunshine<Consistency...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsGritful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Grit}; };
 
-template
-<
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class...Consistency
->
-constexpr bool IsGritful_v<Sunshine<Consistency...>> {true};
+template<typename Target>
+constexpr bool IsGritful_v {Kind<Target>::value == Kinds::Grit};
 
 }}
 
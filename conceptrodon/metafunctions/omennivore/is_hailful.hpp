@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_HAILFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_HAILFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsHailful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-    template<template<template<auto...> class...> class...> class...Melancholy
->
-struct IsHailful<Tranquil<Melancholy...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsHailful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Hail}; };
 
-template
-<
-    template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-    template<template<template<auto...> class...> class...> class...Melancholy
->
-constexpr bool IsHailful_v<Tranquil<Melancholy...>> {true};
+template<typename Target>
+constexpr bool IsHailful_v {Kind<Target>::value == Kinds::Hail};
 
 }}
 
@@ -4,22 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_MOLDFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_MOLDFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsMoldful
-{ static constexpr bool value {false}; };
-
-template<template<typename...> class Container, typename...Elements>
-struct IsMoldful<Container<Elements...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsMoldful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Mold}; };
 
-template<template<typename...> class Container, typename...Elements>
-constexpr bool IsMoldful_v<Container<Elements...>> {true};
+template<typename Target>
+constexpr bool IsMoldful_v {Kind<Target>::value == Kinds::Mold};
 
 }}
 
@@ -4,22 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_PAGEFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_PAGEFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsPageful
-{ static constexpr bool value {false}; };
-
-template<template<auto...> class Sequence, auto...Variables>
-struct IsPageful<Sequence<Variables...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsPageful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Page}; };
 
-template<template<auto...> class Sequence, auto...Variables>
-constexpr bool IsPageful_v<Sequence<Variables...>> {true};
+template<typename Target>
+constexpr bool IsPageful_v {Kind<Target>::value == Kinds::Page};
 
 }}
 
@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_RAILFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_RAILFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsRailful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<auto...> class...> class Stockroom,
-    template<auto...> class...Sequences
->
-struct IsRailful<Stockroom<Sequences...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsRailful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Rail}; };
 
-template
-<
-    template<template<auto...> class...> class Stockroom,
-    template<auto...> class...Sequences
->
-constexpr bool IsRailful_v<Stockroom<Sequences...>> {true};
+template<typename Target>
+constexpr bool IsRailful_v {Kind<Target>::value == Kinds::Rail};
 
 }}
 
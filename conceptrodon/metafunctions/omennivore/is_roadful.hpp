@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_ROADFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_ROADFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsRoadful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<typename...> class...> class Warehouse,
-    template<typename...> class...Containers
->
-struct IsRoadful<Warehouse<Containers...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsRoadful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Road}; };
 
-template
-<
-    template<template<typename...> class...> class Warehouse,
-    template<typename...> class...Containers
->
-constexpr bool IsRoadful_v<Warehouse<Containers...>> {true};
+template<typename Target>
+constexpr bool IsRoadful_v {Kind<Target>::value == Kinds::Road};
 
 }}
 
@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_SAILFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_SAILFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsSailful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<auto...> class...> class...> class Melancholy,
-    template<template<auto...> class...> class...Stockrooms
->
-struct IsSailful<Melancholy<Stockrooms...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsSailful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Sail}; };
 
-template
-<
-    template<template<template<auto...> class...> class...> class Melancholy,
-    template<template<auto...> class...> class...Stockrooms
->
-constexpr bool IsSailful_v<Melancholy<Stockrooms...>> {true};
+template<typename Target>
+constexpr bool IsSailful_v {Kind<Target>::value == Kinds::Sail};
 
 }}
 
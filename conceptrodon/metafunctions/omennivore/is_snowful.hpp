@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_SNOWFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_SNOWFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsSnowful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<typename...> class...> class...> class...> class Silence,
-    template<template<template<typename...> class...> class...> class...Sorrow
->
-struct IsSnowful<Silence<Sorrow...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsSnowful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Snow}; };
 
-template
-<
-    template<template<template<template<typename...> class...> class...> class...> class Silence,
-    template<template<template<typename...> class...> class...> class...Sorrow
->
-constexpr bool IsSnowful_v<Silence<Sorrow...>> {true};
+template<typename Target>
+constexpr bool IsSnowful_v {Kind<Target>::value == Kinds::Snow};
 
 }}
 
@@ -4,30 +4,17 @@
 #ifndef CONCEPTRODON_OMENNIVORE_IS_WILLFUL_H
 #define CONCEPTRODON_OMENNIVORE_IS_WILLFUL_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
     
-template<typename>
+template<typename Target>
 struct IsWillful
-{ static constexpr bool value {false}; };
-
-template
-<
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class...Perseverance
->
-struct IsWillful<Sunshine<Perseverance...>>
-{ static constexpr bool value {true}; };
-
-template<typename>
-constexpr bool IsWillful_v {false};
+{ static constexpr bool value {Kind<Target>::value == Kinds::Will}; };
 
-template
-<
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class...Perseverance
->
-constexpr bool IsWillful_v<Sunshine<Perseverance...>> {true};
+template<typename Target>
+constexpr bool IsWillful_v {Kind<Target>::value == Kinds::Will};
 
 }}
 
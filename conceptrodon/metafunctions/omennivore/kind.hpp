@@ -0,0 +1,381 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_KIND_H
+#define CONCEPTRODON_OMENNIVORE_KIND_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vehicle.hpp"
+#include "conceptrodon/utilities/carrier.hpp"
+#include "conceptrodon/utilities/reverie.hpp"
+#include "conceptrodon/utilities/phantom.hpp"
+#include "conceptrodon/utilities/forlorn.hpp"
+#include "conceptrodon/utilities/travail.hpp"
+#include "conceptrodon/utilities/lullaby.hpp"
+#include "conceptrodon/utilities/halcyon.hpp"
+#include "conceptrodon/utilities/pursuit.hpp"
+#include "conceptrodon/utilities/persist.hpp"
+#include "conceptrodon/utilities/sunrise.hpp"
+#include "conceptrodon/utilities/morning.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/lazy.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/spread.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+
+// Each tag is named after the member template that accepts the arguments of the packed vessel.
+// `TypedPage` stands for sequences such as `std::integer_sequence`,
+// whose variables follow a type.
+enum class Kinds
+{
+    Unknown,
+    Mold, Page, TypedPage,
+    Road, Rail,
+    Flow, Sail,
+    Snow, Hail,
+    Cool, Calm,
+    Grit, Will,
+    Glow, Dawn
+};
+
+// `Kind` matches the shape of a packed vessel once.
+// - `value` is the tag of the shape;
+// - `size` is the number of arguments;
+// - `type` holds the arguments in the corresponding Conceptrodon vessel;
+// - `Relay<Operation>` invokes the member of `Operation` named after the tag with the arguments;
+// - The member named after the tag repacks new arguments into the vessel.
+template<typename>
+struct Kind
+{ static constexpr auto value {Kinds::Unknown}; };
+
+template
+<
+    template<typename...> class Container,
+    typename...Elements
+>
+struct Kind<Container<Elements...>>
+{
+    static constexpr auto value {Kinds::Mold};
+    static constexpr size_t size {sizeof...(Elements)};
+
+    using type = Capsule<Elements...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Mold<Elements...>;
+
+    template<typename...Agreements>
+    using Mold = Container<Agreements...>;
+};
+
+template
+<
+    template<auto...> class Sequence,
+    auto...Variables
+>
+struct Kind<Sequence<Variables...>>
+{
+    static constexpr auto value {Kinds::Page};
+    static constexpr size_t size {sizeof...(Variables)};
+
+    using type = Shuttle<Variables...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Page<Variables...>;
+
+    template<auto...Agreements>
+    using Page = Sequence<Agreements...>;
+};
+
+template
+<
+    template<typename, auto...> class Sequence,
+    typename Type,
+    auto...Variables
+>
+struct Kind<Sequence<Type, Variables...>>
+{
+    static constexpr auto value {Kinds::TypedPage};
+    static constexpr size_t size {sizeof...(Variables)};
+
+    using type = Shuttle<Variables...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Page<Variables...>;
+
+    template<auto...Agreements>
+    using Page = Sequence<Type, static_cast<Type>(Agreements)...>;
+};
+
+template
+<
+    template<template<typename...> class...> class Warehouse,
+    template<typename...> class...Containers
+>
+struct Kind<Warehouse<Containers...>>
+{
+    static constexpr auto value {Kinds::Road};
+    static constexpr size_t size {sizeof...(Containers)};
+
+    using type = Vehicle<Containers...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Road<Containers...>;
+
+    template<template<typename...> class...Agreements>
+    using Road = Warehouse<Agreements...>;
+};
+
+template
+<
+    template<template<auto...> class...> class Stockroom,
+    template<auto...> class...Sequences
+>
+struct Kind<Stockroom<Sequences...>>
+{
+    static constexpr auto value {Kinds::Rail};
+    static constexpr size_t size {sizeof...(Sequences)};
+
+    using type = Carrier<Sequences...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Rail<Sequences...>;
+
+    template<template<auto...> class...Agreements>
+    using Rail = Stockroom<Agreements...>;
+};
+
+template
+<
+    template<template<template<typename...> class...> class...> class Sorrow,
+    template<template<typename...> class...> class...Warehouses
+>
+struct Kind<Sorrow<Warehouses...>>
+{
+    static constexpr auto value {Kinds::Flow};
+    static constexpr size_t size {sizeof...(Warehouses)};
+
+    using type = Reverie<Warehouses...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Flow<Warehouses...>;
+
+    template<template<template<typename...> class...> class...Agreements>
+    using Flow = Sorrow<Agreements...>;
+};
+
+template
+<
+    template<template<template<auto...> class...> class...> class Melancholy,
+    template<template<auto...> class...> class...Stockrooms
+>
+struct Kind<Melancholy<Stockrooms...>>
+{
+    static constexpr auto value {Kinds::Sail};
+    static constexpr size_t size {sizeof...(Stockrooms)};
+
+    using type = Phantom<Stockrooms...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Sail<Stockrooms...>;
+
+    template<template<template<auto...> class...> class...Agreements>
+    using Sail = Melancholy<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<typename...> class...> class...> class...> class Silence,
+    template<template<template<typename...> class...> class...> class...Sorrow
+>
+struct Kind<Silence<Sorrow...>>
+{
+    static constexpr auto value {Kinds::Snow};
+    static constexpr size_t size {sizeof...(Sorrow)};
+
+    using type = Forlorn<Sorrow...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Snow<Sorrow...>;
+
+    template<template<template<template<typename...> class...> class...> class...Agreements>
+    using Snow = Silence<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<auto...> class...> class...> class...> class Tranquil,
+    template<template<template<auto...> class...> class...> class...Melancholy
+>
+struct Kind<Tranquil<Melancholy...>>
+{
+    static constexpr auto value {Kinds::Hail};
+    static constexpr size_t size {sizeof...(Melancholy)};
+
+    using type = Travail<Melancholy...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Hail<Melancholy...>;
+
+    template<template<template<template<auto...> class...> class...> class...Agreements>
+    using Hail = Tranquil<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
+    template<template<template<template<typename...> class...> class...> class...> class...Silence
+>
+struct Kind<Consistency<Silence...>>
+{
+    static constexpr auto value {Kinds::Cool};
+    static constexpr size_t size {sizeof...(Silence)};
+
+    using type = Lullaby<Silence...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Cool<Silence...>;
+
+    template<template<template<template<template<typename...> class...> class...> class...> class...Agreements>
+    using Cool = Consistency<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
+    template<template<template<template<auto...> class...> class...> class...> class...Tranquil
+>
+struct Kind<Perseverance<Tranquil...>>
+{
+    static constexpr auto value {Kinds::Calm};
+    static constexpr size_t size {sizeof...(Tranquil)};
+
+    using type = Halcyon<Tranquil...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Calm<Tranquil...>;
+
+    template<template<template<template<template<auto...> class...> class...> class...> class...Agreements>
+    using Calm = Perseverance<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
+    template<template<template<template<template<typename...> class...> class...> class...> class...> class...Consistency
+>
+struct Kind<Sunshine<Consistency...>>
+{
+    static constexpr auto value {Kinds::Grit};
+    static constexpr size_t size {sizeof...(Consistency)};
+
+    using type = Pursuit<Consistency...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Grit<Consistency...>;
+
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...Agreements>
+    using Grit = Sunshine<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
+    template<template<template<template<template<auto...> class...> class...> class...> class...> class...Perseverance
+>
+struct Kind<Sunshine<Perseverance...>>
+{
+    static constexpr auto value {Kinds::Will};
+    static constexpr size_t size {sizeof...(Perseverance)};
+
+    using type = Persist<Perseverance...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Will<Perseverance...>;
+
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...Agreements>
+    using Will = Sunshine<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Sunshines
+>
+struct Kind<Sunlight<Sunshines...>>
+{
+    static constexpr auto value {Kinds::Glow};
+    static constexpr size_t size {sizeof...(Sunshines)};
+
+    using type = Sunrise<Sunshines...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Glow<Sunshines...>;
+
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Agreements>
+    using Glow = Sunlight<Agreements...>;
+};
+
+template
+<
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Sunshines
+>
+struct Kind<Sunlight<Sunshines...>>
+{
+    static constexpr auto value {Kinds::Dawn};
+    static constexpr size_t size {sizeof...(Sunshines)};
+
+    using type = Morning<Sunshines...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Dawn<Sunshines...>;
+
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Agreements>
+    using Dawn = Sunlight<Agreements...>;
+};
+
+// Symbolic sequences, such as `Varybivore::Range`, compute their variables
+// instead of holding them as template arguments.
+// They are classified as `Kinds::Page` and expanded through `Varbola::Spread`.
+template
+<
+    template<auto...> class Sequence,
+    auto...Variables
+>
+requires Varbola::Symbolic<Sequence<Variables...>>
+struct Kind<Sequence<Variables...>>
+: public Varbola::Spread<Sequence<Variables...>>
+{ static constexpr auto value {Kinds::Page}; };
+
+// The sequences returned by the operations of `Varbola::Lazy` are matched by name,
+// since some of them take the same shape as a Mold vessel.
+template<typename Origin, size_t Start, size_t End>
+struct Kind<Varbola::Sliced<Origin, Start, End>>
+: public Varbola::Spread<Varbola::Sliced<Origin, Start, End>>
+{ static constexpr auto value {Kinds::Page}; };
+
+template<typename Origin, size_t Start, size_t End>
+struct Kind<Varbola::Expunged<Origin, Start, End>>
+: public Varbola::Spread<Varbola::Expunged<Origin, Start, End>>
+{ static constexpr auto value {Kinds::Page}; };
+
+template<typename Origin, size_t Amount>
+struct Kind<Varbola::Swiveled<Origin, Amount>>
+: public Varbola::Spread<Varbola::Swiveled<Origin, Amount>>
+{ static constexpr auto value {Kinds::Page}; };
+
+template<typename Origin>
+struct Kind<Varbola::Reversed<Origin>>
+: public Varbola::Spread<Varbola::Reversed<Origin>>
+{ static constexpr auto value {Kinds::Page}; };
+
+template<typename Origin, template<auto...> class Device>
+struct Kind<Varbola::Gauged<Origin, Device>>
+: public Varbola::Spread<Varbola::Gauged<Origin, Device>>
+{ static constexpr auto value {Kinds::Page}; };
+
+}}
+
+#endif
@@ -4,6 +4,8 @@
 #ifndef CONCEPTRODON_OMENNIVORE_PRESS_H
 #define CONCEPTRODON_OMENNIVORE_PRESS_H
 
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
 namespace Conceptrodon {
 namespace Omennivore {
 
@@ -13,298 +15,23 @@ struct Press
     template<typename...>
     struct Detail {};
 
-/******************************************************************************************************/
-    template
-    <
-        template<typename...> class Container,
-        typename...Contents
-    >
-    struct Detail<Container<Contents...>>
-    { using type = Operation::template Mold<Contents...>; };
-
-    template
-    <
-        template<auto...> class Sequence,
-        auto...Contents
-    >
-    struct Detail<Sequence<Contents...>>
-    { using type = Operation::template Page<Contents...>; };
-
-    template
-    <
-        template<template<typename...> class...> class Warehouse,
-        template<typename...> class...Contents
-    >
-    struct Detail<Warehouse<Contents...>>
-    { using type = Operation::template Road<Contents...>; };
-
-    template
-    <
-        template<template<auto...> class...> class Stockroom,
-        template<auto...> class...Contents
-    >
-    struct Detail<Stockroom<Contents...>>
-    { using type = Operation::template Rail<Contents...>; };
-
-    template
-    <
-        template<template<template<typename...> class...> class...> class Sorrow,
-        template<template<typename...> class...> class...Contents
-    >
-    struct Detail<Sorrow<Contents...>>
-    { using type = Operation::template Flow<Contents...>; };
-
-    template
-    <
-        template<template<template<auto...> class...> class...> class Melancholy,
-        template<template<auto...> class...> class...Contents
-    >
-    struct Detail<Melancholy<Contents...>>
-    { using type = Operation::template Sail<Contents...>; };
-
-    template
-    <
-        template<template<template<template<typename...> class...> class...> class...> class Silence,
-        template<template<template<typename...> class...> class...> class...Contents
-    >
-    struct Detail<Silence<Contents...>>
-    { using type = Operation::template Snow<Contents...>; };
-
-    template
-    <
-        template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-        template<template<template<auto...> class...> class...> class...Contents
-    >
-    struct Detail<Tranquil<Contents...>>
-    { using type = Operation::template Hail<Contents...>; };
-
-    template
-    <
-        template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-        template<template<template<template<typename...> class...> class...> class...> class...Contents
-    >
-    struct Detail<Consistency<Contents...>>
-    { using type = Operation::template Cool<Contents...>; };
-
-    template
-    <
-        template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
-        template<template<template<template<auto...> class...> class...> class...> class...Contents
-    >
-    struct Detail<Perseverance<Contents...>>
-    { using type = Operation::template Calm<Contents...>; };
-
-    template
-    <
-        template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-        template<template<template<template<template<typename...> class...> class...> class...> class...> class...Contents
-    >
-    struct Detail<Sunshine<Contents...>>
-    { using type = Operation::template Grit<Contents...>; };
-
-    template
-    <
-        template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-        template<template<template<template<template<auto...> class...> class...> class...> class...> class...Contents
-    >
-    struct Detail<Sunshine<Contents...>>
-    { using type = Operation::template Will<Contents...>; };
-
-    template
-    <
-        template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-        template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Contents
-    >
-    struct Detail<Sunlight<Contents...>>
-    { using type = Operation::template Glow<Contents...>; };
-
-    template
-    <
-        template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-        template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Contents
-    >
-    struct Detail<Sunlight<Contents...>>
-    { using type = Operation::template Dawn<Contents...>; };
-/******************************************************************************************************/
-
-
-
-
-/******************************************************************************************************/
-    template
-    <
-        template<typename...> class Container,
-        typename...Contents,
-        typename...Others
-    >
-    struct Detail<Container<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Mold<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<auto...> class Sequence,
-        auto...Contents,
-        typename...Others
-    >
-    struct Detail<Sequence<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Page<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<typename...> class...> class Warehouse,
-        template<typename...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Warehouse<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Road<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<auto...> class...> class Stockroom,
-        template<auto...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Stockroom<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Rail<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<typename...> class...> class...> class Sorrow,
-        template<template<typename...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Sorrow<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Flow<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<auto...> class...> class...> class Melancholy,
-        template<template<auto...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Melancholy<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Sail<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<template<typename...> class...> class...> class...> class Silence,
-        template<template<template<typename...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Silence<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Snow<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-        template<template<template<auto...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Tranquil<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Hail<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-        template<template<template<template<typename...> class...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Consistency<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Cool<Contents...>>
-        ::template Detail<Others...>::type;
-    };
+    // `Kind<Item>::Relay` invokes the member of `Operation`
+    // that accepts the arguments of `Item`.
+    template<typename Item>
+    struct Detail<Item>
+    { using type = Kind<Item>::template Relay<Operation>; };
 
-    template
-    <
-        template<template<template<template<template<auto...> class...> class...> class...> class...> class Perserverance,
-        template<template<template<template<auto...> class...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Perserverance<Contents...>, Others...>
+    template<typename Item, typename...Others>
+    struct Detail<Item, Others...>
     {
-        using type = Press<typename Operation::template Calm<Contents...>>
+        using type = Press<typename Kind<Item>::template Relay<Operation>>
         ::template Detail<Others...>::type;
     };
 
-    template
-    <
-        template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-        template<template<template<template<template<typename...> class...> class...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Sunshine<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Grit<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-        template<template<template<template<template<auto...> class...> class...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Sunshine<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Will<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-        template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Sunlight<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Glow<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-
-    template
-    <
-        template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-        template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Contents,
-        typename...Others
-    >
-    struct Detail<Sunlight<Contents...>, Others...>
-    {
-        using type = Press<typename Operation::template Dawn<Contents...>>
-        ::template Detail<Others...>::type;
-    };
-/******************************************************************************************************/
-
-
     template<typename...Agreements>
     using Mold = Detail<Agreements...>::type;
 };
 
 }}
 
-#endif
\ No newline at end of file
+#endif
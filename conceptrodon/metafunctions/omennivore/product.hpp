@@ -0,0 +1,144 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_PRODUCT_H
+#define CONCEPTRODON_OMENNIVORE_PRODUCT_H
+
+#include <utility>
+#include "conceptrodon/concepts/omennivore/all_moldful.hpp"
+#include "conceptrodon/metafunctions/omennivore/total.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/unravel.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+
+
+
+/**** value ****/
+/******************************************************************************************************/
+template<typename...Packages>
+struct Product
+{
+    template<template<auto...> class Operation>
+    struct ProtoRail
+    {
+        template<size_t I>
+        struct Detail
+        {
+            static constexpr auto digits
+            {Ominuci::unravel<Total<Packages>::value...>(I)};
+
+            template<typename>
+            struct Hidden {};
+
+            template<size_t...J>
+            struct Hidden<std::index_sequence<J...>>
+            {
+                using type = Operation
+                <Ominuci::Lineup<Packages>::template Page_v<digits[J]>...>;
+            };
+
+            using type = Hidden<std::index_sequence_for<Packages...>>::type;
+        };
+
+        template<auto...Agreements>
+        using Page = Detail<Agreements...>::type;
+
+/**** Common Section ****//**** Start ****/
+        template<template<typename...> class OuterOperation>
+        struct Hidden
+        {
+            template<typename...>
+            struct Secret {};
+
+            template<size_t...I>
+            struct Secret<std::index_sequence<I...>>
+            { using type = OuterOperation<typename Detail<I>::type...>; };
+
+            using type = Secret
+            <std::make_index_sequence<(1 * ... * Total<Packages>::value)>>
+            ::type;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Hidden<Agreements...>::type;
+/**** Common Section ****//**** End ****/
+
+    };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>;
+
+    static constexpr size_t value {(1 * ... * Total<Packages>::value)};
+};
+/******************************************************************************************************/
+
+
+
+/**** type ****/
+/******************************************************************************************************/
+template<typename...Packages>
+requires AllMoldful<Packages...>
+struct Product<Packages...>
+{
+    template<template<typename...> class Operation>
+    struct ProtoRoad
+    {
+        template<size_t I>
+        struct Detail
+        {
+            static constexpr auto digits
+            {Ominuci::unravel<Total<Packages>::value...>(I)};
+
+            template<typename>
+            struct Hidden {};
+
+            template<size_t...J>
+            struct Hidden<std::index_sequence<J...>>
+            {
+                using type = Operation
+                <typename Ominuci::Lineup<Packages>::template UniPage<digits[J]>...>;
+            };
+
+            using type = Hidden<std::index_sequence_for<Packages...>>::type;
+        };
+
+        template<auto...Agreements>
+        using Page = Detail<Agreements...>::type;
+
+/**** Common Section ****//**** Start ****/
+        template<template<typename...> class OuterOperation>
+        struct Hidden
+        {
+            template<typename...>
+            struct Secret {};
+
+            template<size_t...I>
+            struct Secret<std::index_sequence<I...>>
+            { using type = OuterOperation<typename Detail<I>::type...>; };
+
+            using type = Secret
+            <std::make_index_sequence<(1 * ... * Total<Packages>::value)>>
+            ::type;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Hidden<Agreements...>::type;
+/**** Common Section ****//**** End ****/
+
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>;
+
+    static constexpr size_t value {(1 * ... * Total<Packages>::value)};
+};
+/******************************************************************************************************/
+
+
+
+
+}}
+
+#endif
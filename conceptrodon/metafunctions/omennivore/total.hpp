@@ -5,6 +5,7 @@
 #define CONCEPTRODON_OMENNIVORE_TOTAL_H
 
 #include <cstddef>
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
 
 namespace Conceptrodon {
 namespace Omennivore {
@@ -12,143 +13,13 @@ namespace Omennivore {
 template<typename>
 struct Total {};
 
-// Element
-template
-<
-    template<typename...> class Container,
-    typename...Elements
->
-struct Total<Container<Elements...>>
-{ static constexpr size_t value = sizeof...(Elements); };
-
-// Variable
-template
-<
-    template<auto...> class Sequence,
-    auto...Variables
->
-struct Total<Sequence<Variables...>>
-{ static constexpr size_t value = sizeof...(Variables); };
-
-// Variable
-template
-<
-    template<typename, auto...> class Sequence,
-    typename Type,
-    auto...Variables
->
-struct Total<Sequence<Type, Variables...>>
-{ static constexpr size_t value = sizeof...(Variables); };
-
-// Mold
-template
-<
-    template<template<typename...> class...> class Warehouse,
-    template<typename...> class...Containers
->
-struct Total<Warehouse<Containers...>>
-{ static constexpr size_t value = sizeof...(Containers); };
-
-// Page
-template
-<
-    template<template<auto...> class...> class Stockroom,
-    template<auto...> class...Sequences
->
-struct Total<Stockroom<Sequences...>>
-{ static constexpr size_t value = sizeof...(Sequences); };
-
-// Road
-template
-<
-    template<template<template<typename...> class...> class...> class Sorrow,
-    template<template<typename...> class...> class...Warehouses
->
-struct Total<Sorrow<Warehouses...>>
-{ static constexpr size_t value = sizeof...(Warehouses); };
-
-// Rail
-template
-<
-    template<template<template<auto...> class...> class...> class Melancholy,
-    template<template<auto...> class...> class...Stockrooms
->
-struct Total<Melancholy<Stockrooms...>>
-{ static constexpr size_t value = sizeof...(Stockrooms); };
-
-// Flow
-template
-<
-    template<template<template<template<typename...> class...> class...> class...> class Silence,
-    template<template<template<typename...> class...> class...> class...Sorrow
->
-struct Total<Silence<Sorrow...>>
-{ static constexpr size_t value = sizeof...(Sorrow); };
-
-// Sail
-template
-<
-    template<template<template<template<auto...> class...> class...> class...> class Tranquil,
-    template<template<template<auto...> class...> class...> class...Melancholy
->
-struct Total<Tranquil<Melancholy...>>
-{ static constexpr size_t value = sizeof...(Melancholy); };
-
-// Snow
-template
-<
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class Consistency,
-    template<template<template<template<typename...> class...> class...> class...> class...Silence
->
-struct Total<Consistency<Silence...>>
-{ static constexpr size_t value = sizeof...(Silence); };
-
-// Hail
-template
-<
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class Perseverance,
-    template<template<template<template<auto...> class...> class...> class...> class...Tranquil
->
-struct Total<Perseverance<Tranquil...>>
-{ static constexpr size_t value = sizeof...(Tranquil); };
-
-// Cool
-template
-<
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<typename...> class...> class...> class...> class...> class...Consistency
->
-struct Total<Sunshine<Consistency...>>
-{ static constexpr size_t value = sizeof...(Consistency); };
-
-// Calm
-template
-<
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class Sunshine,
-    template<template<template<template<template<auto...> class...> class...> class...> class...> class...Perseverance
->
-struct Total<Sunshine<Perseverance...>>
-{ static constexpr size_t value = sizeof...(Perseverance); };
+template<typename Target>
+requires (Kind<Target>::value != Kinds::Unknown)
+struct Total<Target>
+{ static constexpr size_t value = Kind<Target>::size; };
 
-// Grit
-template
-<
-    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Sunshines
->
-struct Total<Sunlight<Sunshines...>>
-{ static constexpr size_t value = sizeof...(Sunshines); };
-
-// Will
-template
-<
-    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class Sunlight,
-    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Sunshines
->
-struct Total<Sunlight<Sunshines...>>
-{ static constexpr size_t value = sizeof...(Sunshines); };
-
-// Glow
+// Vessels one level above Glow and Dawn have no corresponding member,
+// so Kind leaves them Unknown and Total counts them directly.
 template
 <
     template<template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...> class...> class Sunlight,
@@ -157,8 +28,6 @@ template
 struct Total<Sunlight<Sunlights...>>
 { static constexpr size_t value = sizeof...(Sunlights); };
 
-
-// Dawn
 template
 <
     template<template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...> class...> class Sunlight,
@@ -172,4 +41,4 @@ constexpr size_t Total_v = Total<PackedVessel>::value;
 
 }}
 
-#endif
\ No newline at end of file
+#endif
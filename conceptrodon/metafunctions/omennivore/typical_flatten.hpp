@@ -0,0 +1,45 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_TYPICAL_FLATTEN_H
+#define CONCEPTRODON_OMENNIVORE_TYPICAL_FLATTEN_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/ravel.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+
+template<typename, auto...>
+struct TypicalFlatten {};
+
+// Without a depth, every level is opened.
+template<typename Tree>
+requires (Kind<Tree>::value != Kinds::Unknown)
+struct TypicalFlatten<Tree>
+: public TypicalFlatten<Tree, static_cast<size_t>(-1)> {};
+
+// The arguments of the other kinds of vessels are not types.
+// Since nothing can be nested, the vessel is returned unchanged.
+template<typename Tree, auto Depth>
+requires (Kind<Tree>::value != Kinds::Unknown)
+struct TypicalFlatten<Tree, Depth>
+{ using type = Tree; };
+
+template<template<typename...> class Container, typename...Items, auto Depth>
+struct TypicalFlatten<Container<Items...>, Depth>
+{
+    using type = Cotanivore::TypicalPaste
+    <
+        Capsule<>,
+        typename Typella::Ravel<Container>::template Detail<Depth, Items>::type...
+    >
+    ::type::template UniRoad<Container>;
+};
+
+}}
+
+#endif
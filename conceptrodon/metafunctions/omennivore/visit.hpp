@@ -0,0 +1,81 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_VISIT_H
+#define CONCEPTRODON_OMENNIVORE_VISIT_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include "conceptrodon/metafunctions/omennivore/product.hpp"
+#include "conceptrodon/metafunctions/omennivore/total.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+
+template<typename...Variants>
+struct Visit
+{
+    template<typename Visitor>
+    struct ProtoMold
+    {
+        using result_type = std::invoke_result_t
+        <Visitor, decltype(std::get<0>(std::declval<Variants>()))...>;
+
+        using pointer_type = result_type(*)(Visitor&&, Variants&&...);
+
+        template<auto...I>
+        struct Entry
+        {
+            static constexpr result_type invoke(Visitor&& visitor, Variants&&...variants)
+            {
+                return std::invoke
+                (
+                    std::forward<Visitor>(visitor),
+                    std::get<I>(std::forward<Variants>(variants))...
+                );
+            }
+        };
+
+        template<typename...Entries>
+        struct Table
+        {
+            static constexpr std::array<pointer_type, sizeof...(Entries)> value
+            {&Entries::invoke...};
+        };
+
+        static constexpr auto value
+        {
+            Product<std::make_index_sequence<Total<std::remove_cvref_t<Variants>>::value>...>
+            ::template Rail<Entry>
+            ::template Road<Table>
+            ::value
+        };
+
+        static constexpr size_t index(std::remove_cvref_t<Variants> const&...variants)
+        {
+            size_t flat {0};
+            ((flat = flat * Total<std::remove_cvref_t<Variants>>::value + variants.index()), ...);
+            return flat;
+        }
+
+        static constexpr result_type visit(Visitor&& visitor, Variants&&...variants)
+        {
+            if ((...||(variants.index() >= Total<std::remove_cvref_t<Variants>>::value)))
+            { throw std::bad_variant_access {}; }
+
+            return value[index(variants...)]
+            (std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);
+        }
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,29 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_PAGELIVORE_FIND_ALL_H
+#define CONCEPTRODON_PAGELIVORE_FIND_ALL_H
+
+#include "conceptrodon/metafunctions/varybivore/kindred_find_all.hpp"
+
+namespace Conceptrodon {
+namespace Pagelivore {
+
+template<template<auto...> class...Predicates>
+struct FindAll
+{
+    template<auto...Variables>
+    using Page = Varybivore::KindredFindAll<Variables...>
+    ::template Rail<Predicates...>;
+
+    template<auto...Variables>
+    static constexpr auto Page_v
+    {
+        Varybivore::KindredFindAll<Variables...>
+        ::template Rail_v<Predicates...>
+    };
+};
+
+}}
+
+#endif
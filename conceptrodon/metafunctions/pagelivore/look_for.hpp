@@ -6,44 +6,49 @@
 
 #include <cstddef>
 #include <type_traits>
+#include "conceptrodon/metafunctions/microbiota/varbola/kindred_find.hpp"
 
 namespace Conceptrodon {
 namespace Pagelivore {
 
+// The variables are examined in blocks.
+// A block is only instantiated if the previous ones contain no match.
 template<template<auto...> class Predicate>
 struct LookFor
 {
+    // Without variables, there is nothing to find.
     template<auto...Variables>
-    struct ProtoPage
+    struct Detail
+    { using type = std::integral_constant<std::make_signed_t<size_t>, -1>; };
+
+    template<auto...Variables>
+    requires (sizeof...(Variables) != 0)
+    struct Detail<Variables...>
     {
-        static constexpr auto value
-        {
-            []() -> std::make_signed_t<size_t>
-            {
-                std::make_signed_t<size_t> counter {-1};
-                return
-                (...||( (++counter, Predicate<Variables>::value) ? true : false)) ? 
-                counter : -1;
-            }()
-        };
+        using type = Varbola::KindredFind<Variables...>
+        ::template ProtoRail<Predicate>;
     };
 
     template<auto...Variables>
-    using Page = ProtoPage<Variables...>;
+    using Page = Detail<Variables...>::type;
 
     template<auto...Variables>
-    static constexpr auto Page_v
+    static constexpr std::make_signed_t<size_t> Page_v
     {
         []() -> std::make_signed_t<size_t>
         {
-            std::make_signed_t<size_t> counter {-1};
-            return
-            (...||( (++counter, Predicate<Variables>::value) ? true : false)) ? 
-            counter : -1;
+            if constexpr (sizeof...(Variables) == 0)
+            { return -1; }
+
+            else
+            {
+                return Varbola::KindredFind<Variables...>
+                ::template Rail_v<Predicate>;
+            }
         }()
     };
 };
 
 }}
 
-#endif
\ No newline at end of file
+#endif
@@ -19,61 +19,121 @@
 #include "conceptrodon/utilities/sunrise.hpp"
 #include "conceptrodon/utilities/morning.hpp"
 
-#include "conceptrodon/metafunctions/omennivore/press.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/trail.hpp"
 
 namespace Conceptrodon {
 namespace Raileus {
 
-template<template<template<auto...> class...> class Operation, typename...Items>
+template<template<template<auto...> class...> class Operation, typename Record = void>
 struct LoadSkip
 {
     struct Commit
     {
         template<template<auto...> class...Sequences>
-        using Rail = Omennivore::Press<Operation<Sequences...>>::template Mold<Items...>;
+        struct ProtoRail
+        { using type = Ominuci::Retrace<Operation<Sequences...>, Record>::type; };
+
+        template<template<auto...> class...Agreements>
+        using Rail = ProtoRail<Agreements...>::type;
     };
 
     template<typename...Elements>
-    using Mold = LoadSkip<Operation, Items..., Capsule<Elements...>>;
+    struct ProtoMold
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Capsule<Elements...>>>; };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>::type;
 
     template<auto...Variables>
-    using Page = LoadSkip<Operation, Items..., Shuttle<Variables...>>;
+    struct ProtoPage
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Shuttle<Variables...>>>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
 
     template<template<typename...> class...Containers>
-    using Road = LoadSkip<Operation, Items..., Vehicle<Containers...>>;
+    struct ProtoRoad
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Vehicle<Containers...>>>; };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
 
     template<template<auto...> class...Sequences>
-    using Rail = LoadSkip<Operation, Items..., Carrier<Sequences...>>;
+    struct ProtoRail
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Carrier<Sequences...>>>; };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>::type;
 
     template<template<template<typename...> class...> class...Warehouses>
-    using Flow = LoadSkip<Operation, Items..., Reverie<Warehouses...>>;
+    struct ProtoFlow
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Reverie<Warehouses...>>>; };
+
+    template<template<template<typename...> class...> class...Agreements>
+    using Flow = ProtoFlow<Agreements...>::type;
 
     template<template<template<auto...> class...> class...Stockrooms>
-    using Sail = LoadSkip<Operation, Items..., Phantom<Stockrooms...>>;
+    struct ProtoSail
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Phantom<Stockrooms...>>>; };
+
+    template<template<template<auto...> class...> class...Agreements>
+    using Sail = ProtoSail<Agreements...>::type;
 
     template<template<template<template<typename...> class...> class...> class...Sorrow>
-    using Snow = LoadSkip<Operation, Items..., Forlorn<Sorrow...>>;
+    struct ProtoSnow
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Forlorn<Sorrow...>>>; };
+
+    template<template<template<template<typename...> class...> class...> class...Agreements>
+    using Snow = ProtoSnow<Agreements...>::type;
 
     template<template<template<template<auto...> class...> class...> class...Melancholy>
-    using Hail = LoadSkip<Operation, Items..., Travail<Melancholy...>>;
+    struct ProtoHail
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Travail<Melancholy...>>>; };
+
+    template<template<template<template<auto...> class...> class...> class...Agreements>
+    using Hail = ProtoHail<Agreements...>::type;
 
     template<template<template<template<template<typename...> class...> class...> class...> class...Silence>
-    using Cool = LoadSkip<Operation, Items..., Lullaby<Silence...>>;
+    struct ProtoCool
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Lullaby<Silence...>>>; };
+
+    template<template<template<template<template<typename...> class...> class...> class...> class...Agreements>
+    using Cool = ProtoCool<Agreements...>::type;
 
     template<template<template<template<template<auto...> class...> class...> class...> class...Tranquil>
-    using Calm = LoadSkip<Operation, Items..., Halcyon<Tranquil...>>;
+    struct ProtoCalm
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Halcyon<Tranquil...>>>; };
+
+    template<template<template<template<template<auto...> class...> class...> class...> class...Agreements>
+    using Calm = ProtoCalm<Agreements...>::type;
 
     template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...Consistency>
-    using Grit = LoadSkip<Operation, Items..., Pursuit<Consistency...>>;
+    struct ProtoGrit
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Pursuit<Consistency...>>>; };
+
+    template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...Agreements>
+    using Grit = ProtoGrit<Agreements...>::type;
 
     template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...Perseverance>
-    using Will = LoadSkip<Operation, Items..., Persist<Perseverance...>>;
+    struct ProtoWill
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Persist<Perseverance...>>>; };
+
+    template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...Agreements>
+    using Will = ProtoWill<Agreements...>::type;
 
     template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Sunshines>
-    using Glow = LoadSkip<Operation, Items..., Sunrise<Sunshines...>>;
+    struct ProtoGlow
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Sunrise<Sunshines...>>>; };
+
+    template<template<template<template<template<template<template<typename...> class...> class...> class...> class...> class...> class...Agreements>
+    using Glow = ProtoGlow<Agreements...>::type;
 
     template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Sunshines>
-    using Dawn = LoadSkip<Operation, Items..., Morning<Sunshines...>>;
+    struct ProtoDawn
+    { using type = LoadSkip<Operation, Ominuci::Trail<Record, Morning<Sunshines...>>>; };
+
+    template<template<template<template<template<template<template<auto...> class...> class...> class...> class...> class...> class...Agreements>
+    using Dawn = ProtoDawn<Agreements...>::type;
 };
 
 }
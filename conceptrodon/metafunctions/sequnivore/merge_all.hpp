@@ -0,0 +1,17 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_SEQUNIVORE_MERGE_ALL_H
+#define CONCEPTRODON_SEQUNIVORE_MERGE_ALL_H
+
+#include "conceptrodon/metafunctions/sequnivore/typical_merge_all.hpp"
+
+namespace Conceptrodon {
+namespace Sequnivore {
+
+template<typename...Sequences>
+using MergeAll = TypicalMergeAll<Sequences...>::type;
+
+}}
+
+#endif
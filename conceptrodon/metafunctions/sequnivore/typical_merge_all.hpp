@@ -0,0 +1,49 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_SEQUNIVORE_TYPICAL_MERGE_ALL_H
+#define CONCEPTRODON_SEQUNIVORE_TYPICAL_MERGE_ALL_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/sequnivore/typical_paste.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/confluence.hpp"
+
+namespace Conceptrodon {
+namespace Sequnivore {
+
+// Every sequence is a sorted run.
+// All runs are merged in one constant evaluation.
+template<typename...Sequences>
+struct TypicalMergeAll
+{
+    template<typename>
+    struct Span {};
+
+    template<template<auto...> class Sequence, auto...Variables>
+    struct Span<Sequence<Variables...>>
+    { static constexpr size_t value {sizeof...(Variables)}; };
+
+    template<typename>
+    struct Detail {};
+
+    template<auto...Variables>
+    struct Detail<Shuttle<Variables...>>
+    {
+        using type = Varbola::Confluence
+        <
+            std::ranges::less {},
+            false,
+            std::array<size_t, sizeof...(Sequences)> {Span<Sequences>::value...},
+            Variables...
+        >::type;
+    };
+
+    using type = Detail<typename TypicalPaste<Shuttle<>, Sequences...>::type>::type;
+};
+
+}}
+
+#endif
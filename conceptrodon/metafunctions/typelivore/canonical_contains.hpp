@@ -0,0 +1,79 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_CANONICAL_CONTAINS_H
+#define CONCEPTRODON_TYPELIVORE_CANONICAL_CONTAINS_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/typelivore/canonicalize.hpp"
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct CanonicalContains
+{
+    template<typename...Canonicals>
+    struct Detail
+    {
+        static constexpr std::array<uint64_t, sizeof...(Canonicals)> fingerprints
+        {Fingerprint<Canonicals>::value...};
+
+        template<typename Inspecting>
+        static constexpr size_t position
+        {
+            static_cast<size_t>
+            (
+                std::ranges::lower_bound(fingerprints, Fingerprint<Inspecting>::value)
+                - fingerprints.begin()
+            )
+        };
+
+        template<typename Inspecting>
+        static consteval bool search()
+        {
+            if constexpr
+            (
+                position<Inspecting> != sizeof...(Canonicals)
+                && fingerprints[position<Inspecting>] == Fingerprint<Inspecting>::value
+            )
+            {
+                // Confirm the match so that a collision cannot produce a false positive.
+                return std::is_same_v
+                <
+                    Inspecting,
+                    typename Ominuci::Lineup<Capsule<Canonicals...>>
+                    ::template UniPage<position<Inspecting>>
+                >;
+            }
+
+            else
+            { return false; }
+        }
+    };
+
+    using Canonical = Canonicalize<Elements...>::template UniRoad<Detail>;
+
+    template<typename Inspecting>
+    struct ProtoMold
+    {
+        static constexpr bool value
+        {Canonical::template search<Inspecting>()};
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+
+    template<typename Inspecting>
+    static constexpr bool Mold_v
+    {Canonical::template search<Inspecting>()};
+};
+
+}}
+
+#endif
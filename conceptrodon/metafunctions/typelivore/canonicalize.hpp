@@ -0,0 +1,134 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_CANONICALIZE_H
+#define CONCEPTRODON_TYPELIVORE_CANONICALIZE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Canonicalize
+{
+    // Indices of the elements sorted by their fingerprints.
+    // Ties are broken by the original indices.
+    static constexpr auto order
+    {
+        []()
+        {
+            std::array<uint64_t, sizeof...(Elements)> fingerprints
+            {Fingerprint<Elements>::value...};
+            std::array<size_t, sizeof...(Elements)> indices {};
+
+            for (size_t i {0}; i < sizeof...(Elements); i++)
+            { indices[i] = i; }
+
+            std::ranges::sort
+            (
+                indices,
+                [&fingerprints](size_t i, size_t j)
+                {
+                    return fingerprints[i] < fingerprints[j]
+                    || (fingerprints[i] == fingerprints[j] && i < j);
+                }
+            );
+
+            return indices;
+        }()
+    };
+
+    // Positions in `order` whose fingerprints repeat the previous ones.
+    static constexpr size_t repetitions
+    {
+        []()
+        {
+            std::array<uint64_t, sizeof...(Elements)> fingerprints
+            {Fingerprint<Elements>::value...};
+            size_t counter {0};
+
+            for (size_t i {1}; i < sizeof...(Elements); i++)
+            {
+                if (fingerprints[order[i]] == fingerprints[order[i - 1]])
+                { counter++; }
+            }
+
+            return counter;
+        }()
+    };
+
+    template<bool Repetitive>
+    static constexpr auto partition
+    {
+        []()
+        {
+            std::array<uint64_t, sizeof...(Elements)> fingerprints
+            {Fingerprint<Elements>::value...};
+            std::array<size_t, Repetitive ? repetitions : sizeof...(Elements) - repetitions> result {};
+            size_t counter {0};
+
+            for (size_t i {0}; i < sizeof...(Elements); i++)
+            {
+                bool repeated {i != 0 && fingerprints[order[i]] == fingerprints[order[i - 1]]};
+
+                if (repeated == Repetitive)
+                { result[counter++] = Repetitive ? i : order[i]; }
+            }
+
+            return result;
+        }()
+    };
+
+    template<size_t I>
+    using Element = Ominuci::Lineup<Capsule<Elements...>>::template UniPage<I>;
+
+    template<typename, typename>
+    struct Detail {};
+
+    template<size_t...I, size_t...J>
+    struct Detail<std::index_sequence<I...>, std::index_sequence<J...>>
+    {
+        // Elements sharing a fingerprint must be the same type.
+        static_assert
+        (
+            (...&&std::is_same_v
+            <
+                Element<order[partition<true>[J]]>,
+                Element<order[partition<true>[J] - 1]>
+            >),
+            "Conceptrodon::Typelivore::Canonicalize: fingerprint collision detected."
+        );
+
+        template<template<typename...> class Operation>
+        using UniRoad = Operation<Element<partition<false>[I]>...>;
+    };
+
+    using Canonical = Detail
+    <
+        std::make_index_sequence<sizeof...(Elements) - repetitions>,
+        std::make_index_sequence<repetitions>
+    >;
+
+    template<template<typename...> class Operation>
+    struct Hidden
+    { using type = Canonical::template UniRoad<Operation>; };
+
+    template<template<typename...> class...Agreements>
+    using Road = Hidden<Agreements...>::type;
+
+    template<template<typename...> class Operation>
+    using UniRoad = Canonical::template UniRoad<Operation>;
+};
+
+}}
+
+#endif
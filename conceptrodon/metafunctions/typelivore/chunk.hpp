@@ -0,0 +1,43 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_CHUNK_H
+#define CONCEPTRODON_TYPELIVORE_CHUNK_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/tessellate.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Chunk
+{
+    template<auto...>
+    struct ProtoPage {};
+
+    template<auto Size>
+    struct ProtoPage<Size>
+    {
+        static_assert
+        (
+            0 < Size,
+            "Conceptrodon::Typelivore::Chunk: size must be positive."
+        );
+
+        using type = Ominuci::Tessellate
+        <
+            Ominuci::Tiling<sizeof...(Elements), Size, Size, true>,
+            Ominuci::Unwrap
+        >
+        ::template Detail<Capsule<Tyy<Elements>...>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_COUNT_H
+#define CONCEPTRODON_TYPELIVORE_COUNT_H
+
+#include <cstddef>
+#include <type_traits>
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+#include "conceptrodon/metafunctions/typelivore/histogram.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Count
+{
+    // The tally is shared by every query.
+    using Census = Histogram<Elements...>;
+
+    using Inspector = Census::template Inspector<typename Census::Distinct>;
+
+    template<typename Inspecting>
+    struct ProtoMold
+    {
+        static constexpr size_t value
+        {Census::tally.count(Fingerprint<Inspecting>::value)};
+
+        // A found fingerprint must belong to `Inspecting` itself.
+        static_assert
+        (
+            value == 0 || std::is_base_of_v<Tyy<Inspecting>, Inspector>,
+            "Conceptrodon::Typelivore::Count: fingerprint collision detected."
+        );
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+
+    template<typename Inspecting>
+    static constexpr size_t Mold_v {ProtoMold<Inspecting>::value};
+};
+
+}}
+
+#endif
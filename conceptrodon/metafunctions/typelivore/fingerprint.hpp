@@ -0,0 +1,23 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_FINGERPRINT_H
+#define CONCEPTRODON_TYPELIVORE_FINGERPRINT_H
+
+#include <cstdint>
+#include "conceptrodon/metafunctions/microbiota/typella/signify.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/digest.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename Element>
+struct Fingerprint
+{ static constexpr uint64_t value {Typella::digest(Typella::signify<Element>())}; };
+
+template<typename Element>
+constexpr uint64_t Fingerprint_v {Typella::digest(Typella::signify<Element>())};
+
+}}
+
+#endif
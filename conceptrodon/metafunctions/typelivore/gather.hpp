@@ -0,0 +1,40 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_GATHER_H
+#define CONCEPTRODON_TYPELIVORE_GATHER_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Gather
+{
+    // Every lookup resolves against the same overload set.
+    using Map = Ominuci::Lineup<Capsule<Elements...>>;
+
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Elements)) && ...)
+    struct ProtoPage
+    {
+        template<template<typename...> class Operation>
+        struct Detail
+        {
+            using type = Operation<typename Map::template UniPage<Indices>...>;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Detail<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,85 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_GROUP_BY_H
+#define CONCEPTRODON_TYPELIVORE_GROUP_BY_H
+
+#include <array>
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/distribute.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct GroupBy
+{
+    template<template<typename...> class KeyExtractor>
+    struct ProtoRoad
+    {
+        // Every key is extracted once.
+        // All keys are required to have the same type.
+        static constexpr std::array keys
+        {KeyExtractor<Elements>::value...};
+
+        using key_type = decltype(keys)::value_type;
+
+        struct Assignment
+        {
+            std::array<size_t, sizeof...(Elements)> buckets {};
+            size_t count {0};
+        };
+
+        // Groups are numbered in the order their keys first appear.
+        static constexpr Assignment assignment
+        {
+            []()
+            {
+                Assignment result {};
+                std::array<key_type, sizeof...(Elements)> seen {};
+
+                for (size_t i {0}; i < sizeof...(Elements); i++)
+                {
+                    size_t bucket {0};
+
+                    while (bucket < result.count && not (seen[bucket] == keys[i]))
+                    { bucket++; }
+
+                    if (bucket == result.count)
+                    { seen[result.count++] = keys[i]; }
+
+                    result.buckets[i] = bucket;
+                }
+
+                return result;
+            }()
+        };
+
+        using type = Ominuci::Distribute
+        <
+            Capsule<Elements...>,
+            assignment.buckets,
+            assignment.count
+        >::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+};
+
+// Without elements, there are no keys to compare.
+template<>
+struct GroupBy<>
+{
+    template<template<typename...> class KeyExtractor>
+    struct ProtoRoad
+    { using type = Capsule<>; };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+};
+
+}}
+
+#endif
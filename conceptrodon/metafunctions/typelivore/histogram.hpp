@@ -0,0 +1,71 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_HISTOGRAM_H
+#define CONCEPTRODON_TYPELIVORE_HISTOGRAM_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/tally.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Histogram
+{
+    // Every fingerprint is computed once.
+    static constexpr auto tally
+    {Ominuci::tally<Fingerprint<Elements>::value...>};
+
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        using Distinct = Cotanivore::TypicalPaste
+        <
+            Capsule<>,
+            std::conditional_t<tally.firsts[I], Capsule<Elements>, Capsule<>>...
+        >::type;
+    };
+
+    template<typename>
+    struct Hidden {};
+
+    template<size_t...I>
+    struct Hidden<std::index_sequence<I...>>
+    { using Counts = Shuttle<tally.counts[I]...>; };
+
+    template<typename>
+    struct Inspector {};
+
+    template<typename...DistinctElements>
+    struct Inspector<Capsule<DistinctElements...>>
+    : public Tyy<DistinctElements>... {};
+
+    using Distinct = Detail<std::index_sequence_for<Elements...>>::Distinct;
+
+    using Counts = Hidden<std::make_index_sequence<tally.size>>::Counts;
+
+    // An element missing from `Distinct` shares its fingerprint
+    // with a different element.
+    static_assert
+    (
+        (...&&std::is_base_of_v<Tyy<Elements>, Inspector<Distinct>>),
+        "Conceptrodon::Typelivore::Histogram: fingerprint collision detected."
+    );
+
+    using type = Capsule<Distinct, Counts>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,92 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_INDEX_H
+#define CONCEPTRODON_TYPELIVORE_INDEX_H
+
+#include <cstddef>
+#include <type_traits>
+#include "conceptrodon/metafunctions/typelivore/amid.hpp"
+#include "conceptrodon/metafunctions/typelivore/amidst.hpp"
+
+// `Among` relies on explicit specializations at class scope, which only Clang accepts.
+#if defined(__clang__)
+#include "conceptrodon/metafunctions/typelivore/among.hpp"
+#endif
+
+
+
+
+/******************************************************************************************************/
+// Define `CONCEPTRODON_TYPELIVORE_INDEX_STRATEGY` as `Among`, `Amid` or `Amidst`
+// to bypass the selection.
+
+// The two thresholds below only apply to Clang.
+// Their defaults are estimates, not measurements:
+// `Among` and `Amidst` do not compile on GCC, and the Clang sweep of
+// `tests/performance/metafunctions/typelivore/index.calibration.test.hpp`
+// (pack lengths 16 to 256 against 1 to 16 lookups) has not been run yet.
+// Replace them with the crossovers it reports.
+
+// Packs no longer than this use `Amidst` for a single lookup.
+#ifndef CONCEPTRODON_TYPELIVORE_INDEX_AMIDST_LIMIT
+#define CONCEPTRODON_TYPELIVORE_INDEX_AMIDST_LIMIT 64
+#endif
+
+// From this many lookups on, the overload set built by `Amid` pays for itself.
+#ifndef CONCEPTRODON_TYPELIVORE_INDEX_AMID_LOOKUPS
+#define CONCEPTRODON_TYPELIVORE_INDEX_AMID_LOOKUPS 8
+#endif
+/******************************************************************************************************/
+
+
+
+
+namespace Conceptrodon {
+namespace Typella {
+
+template<size_t Lookups, typename...Elements>
+struct Indexer
+{
+#if defined(CONCEPTRODON_TYPELIVORE_INDEX_STRATEGY)
+    using type = Typelivore::CONCEPTRODON_TYPELIVORE_INDEX_STRATEGY<Elements...>;
+#elif defined(__clang__)
+    using type = std::conditional_t
+    <
+        Lookups == 1 && sizeof...(Elements) <= CONCEPTRODON_TYPELIVORE_INDEX_AMIDST_LIMIT,
+        Typelivore::Amidst<Elements...>,
+        std::conditional_t
+        <
+            Lookups < CONCEPTRODON_TYPELIVORE_INDEX_AMID_LOOKUPS,
+            Typelivore::Among<Elements...>,
+            Typelivore::Amid<Elements...>
+        >
+    >;
+#else
+    // GCC rejects `Among` and fails to deduce the prefix pack of `Amidst`.
+    using type = Typelivore::Amid<Elements...>;
+#endif
+};
+
+}
+
+namespace Typelivore {
+
+template<typename...Elements>
+struct Index
+{
+    template<size_t Lookups>
+    using Expect = Typella::Indexer<Lookups, Elements...>::type;
+
+    // `Lookups` announces how many times the list will be looked up.
+    template<size_t Lookups, auto...Agreements>
+    using Foresee = Typella::Indexer<Lookups, Elements...>::type
+    ::template Page<Agreements...>;
+
+    template<auto...Agreements>
+    using Page = Foresee<1, Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_INTERSECTION_H
+#define CONCEPTRODON_TYPELIVORE_INTERSECTION_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Intersection
+{
+    template<typename...Others>
+    struct ProtoMold
+    {
+        struct Inspector
+        : public Tyy<Others>... {};
+
+        // Indices of the elements present in the arguments.
+        static constexpr auto kept
+        {Ominuci::sift<std::is_base_of_v<Tyy<Elements>, Inspector>...>};
+
+        template<typename>
+        struct Detail {};
+
+        template<size_t...I>
+        struct Detail<std::index_sequence<I...>>
+        {
+            using type = Capsule
+            <
+                typename Ominuci::Lineup<Capsule<Elements...>>
+                ::template UniPage<kept[I]>...
+            >;
+        };
+
+        using type = Detail<std::make_index_sequence<kept.size()>>::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_KINDRED_FIND_ALL_H
+#define CONCEPTRODON_TYPELIVORE_KINDRED_FIND_ALL_H
+
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct KindredFindAll
+{
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    {
+        template<typename Element>
+        struct Detail
+        { static constexpr bool value {(...&&static_cast<bool>(Predicates<Element>::value))}; };
+
+        // Every predicate is evaluated once per element.
+        static constexpr auto value
+        {Ominuci::sift<Detail<Elements>::value...>};
+
+        template<typename>
+        struct Harvest {};
+
+        template<size_t...I>
+        struct Harvest<std::index_sequence<I...>>
+        { using type = Shuttle<value[I]...>; };
+
+        using type = Harvest<std::make_index_sequence<value.size()>>::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+
+    template<template<typename...> class...Agreements>
+    static constexpr auto Road_v
+    {ProtoRoad<Agreements...>::value};
+};
+
+}}
+
+#endif
@@ -0,0 +1,36 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_KINDRED_FOLD_LEFT_ALL_H
+#define CONCEPTRODON_TYPELIVORE_KINDRED_FOLD_LEFT_ALL_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/ledger.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct KindredFoldLeftAll
+{
+    template<typename Initiator>
+    struct ProtoMold
+    {
+        template<template<typename...> class Operation>
+        struct ProtoRoad
+        {
+            using type = Typella::Ledger<Operation>
+            ::template Detail<Capsule<>, Initiator, Elements...>::type;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = ProtoRoad<Agreements...>::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,38 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_PARTITION_H
+#define CONCEPTRODON_TYPELIVORE_PARTITION_H
+
+#include <array>
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/distribute.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Partition
+{
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    {
+        template<typename Element>
+        struct Detail
+        { static constexpr bool value {(...&&static_cast<bool>(Predicates<Element>::value))}; };
+
+        // The elements satisfying all predicates go to the first bucket.
+        static constexpr std::array<size_t, sizeof...(Elements)> buckets
+        {(Detail<Elements>::value ? 0 : 1)...};
+
+        using type = Ominuci::Distribute<Capsule<Elements...>, buckets, 2>::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_ROPE_H
+#define CONCEPTRODON_TYPELIVORE_ROPE_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/knot.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+// A leaf of a rope.
+// `Paste` knots ropes into a shallow tree instead of copying their elements.
+// Elements are only collected into a flat list by `Road` or `UniRoad`.
+template<typename...Elements>
+struct Rope
+{
+    static constexpr size_t height {1};
+
+    static constexpr bool perfect {true};
+
+    static constexpr size_t size() { return sizeof...(Elements); }
+
+    template<size_t I>
+    requires (I < sizeof...(Elements))
+    using Among = Ominuci::Lineup<Capsule<Elements...>>::template UniPage<I>;
+
+    template<typename...Ropes>
+    using Paste = Typella::Stitch<Rope, Ropes...>::type;
+
+    template<template<typename...> class Container>
+    struct ProtoRoad
+    { using type = Container<Elements...>; };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+
+    template<template<typename...> class Container>
+    using UniRoad = Container<Elements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_RUN_LENGTH_ENCODE_H
+#define CONCEPTRODON_TYPELIVORE_RUN_LENGTH_ENCODE_H
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct RunLengthEncode
+{
+    // Never equal to any element.
+    struct Sentinel;
+
+    template<typename, typename>
+    struct Detail {};
+
+    // Each element is compared with its successor
+    // by expanding the list against a copy shifted by one.
+    template<typename...Previous, typename...Current>
+    struct Detail<Capsule<Previous...>, Capsule<Current...>>
+    {
+        // `ends[I]` is true if a run ends right before `I`.
+        // The first entry compares `Sentinel` with the first element,
+        // and the last entry closes the final run.
+        static constexpr std::array<bool, sizeof...(Current)> ends
+        {(not std::is_same_v<Previous, Current>)...};
+
+        struct Runs
+        {
+            std::array<size_t, sizeof...(Elements)> lengths {};
+            size_t size {0};
+        };
+
+        static constexpr Runs runs
+        {
+            []()
+            {
+                Runs result {};
+                size_t start {0};
+
+                for (size_t i {1}; i < sizeof...(Current); i++)
+                {
+                    if (ends[i])
+                    {
+                        result.lengths[result.size++] = i - start;
+                        start = i;
+                    }
+                }
+
+                return result;
+            }()
+        };
+
+        template<typename>
+        struct Hidden {};
+
+        template<size_t...I>
+        struct Hidden<std::index_sequence<I...>>
+        { using type = Shuttle<runs.lengths[I]...>; };
+
+        // The last element of each run represents the run.
+        using Distinct = Cotanivore::TypicalPaste
+        <
+            Capsule<>,
+            std::conditional_t
+            <
+                std::is_same_v<Previous, Current> || std::is_same_v<Previous, Sentinel>,
+                Capsule<>,
+                Capsule<Previous>
+            >...
+        >::type;
+
+        using Counts = Hidden<std::make_index_sequence<runs.size>>::type;
+    };
+
+    using Encoding = Detail
+    <
+        Capsule<Sentinel, Elements...>,
+        Capsule<Elements..., Sentinel>
+    >;
+
+    using Distinct = Encoding::Distinct;
+
+    using Counts = Encoding::Counts;
+
+    using type = Capsule<Distinct, Counts>;
+};
+
+}}
+
+#endif
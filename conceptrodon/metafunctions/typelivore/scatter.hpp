@@ -0,0 +1,77 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_SCATTER_H
+#define CONCEPTRODON_TYPELIVORE_SCATTER_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Scatter
+{
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Elements)) && ...)
+    struct ProtoPage
+    {
+        // `slots[I]` is one past the position of the replacement for `Elements[I]`,
+        // or zero if `Elements[I]` is kept.
+        // A later index overwrites an earlier one.
+        static constexpr auto slots
+        {
+            []()
+            {
+                std::array<size_t, sizeof...(Elements)> slots {};
+                size_t slot {};
+                ((slots[Indices] = ++slot), ...);
+                return slots;
+            }()
+        };
+
+        template<typename...Replacements>
+        requires (sizeof...(Replacements) == sizeof...(Indices))
+        struct ProtoMold
+        {
+            template<size_t Slot, typename Element>
+            struct Pick
+            {
+                using type = Ominuci::Lineup<Capsule<Replacements...>>
+                ::template UniPage<Slot - 1>;
+            };
+
+            template<typename Element>
+            struct Pick<0, Element>
+            {
+                using type = Element;
+            };
+
+            template<template<typename...> class Operation, typename>
+            struct Detail {};
+
+            template<template<typename...> class Operation, size_t...I>
+            struct Detail<Operation, std::index_sequence<I...>>
+            {
+                using type = Operation<typename Pick<slots[I], Elements>::type...>;
+            };
+
+            template<template<typename...> class...Agreements>
+            using Road = Detail<Agreements..., std::index_sequence_for<Elements...>>::type;
+        };
+
+        template<typename...Agreements>
+        using Mold = ProtoMold<Agreements...>;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,66 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_SYMMETRIC_DIFFERENCE_H
+#define CONCEPTRODON_TYPELIVORE_SYMMETRIC_DIFFERENCE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct SymmetricDifference
+{
+    struct Inspector
+    : public Tyy<Elements>... {};
+
+    template<typename...Others>
+    struct ProtoMold
+    {
+        struct Examiner
+        : public Tyy<Others>... {};
+
+        // Indices of the elements absent from the arguments.
+        static constexpr auto front
+        {Ominuci::sift<not std::is_base_of_v<Tyy<Elements>, Examiner>...>};
+
+        // Indices of the arguments absent from `Elements`.
+        static constexpr auto back
+        {Ominuci::sift<not std::is_base_of_v<Tyy<Others>, Inspector>...>};
+
+        template<typename, typename>
+        struct Detail {};
+
+        template<size_t...I, size_t...J>
+        struct Detail<std::index_sequence<I...>, std::index_sequence<J...>>
+        {
+            using type = Capsule
+            <
+                typename Ominuci::Lineup<Capsule<Elements...>>
+                ::template UniPage<front[I]>...,
+                typename Ominuci::Lineup<Capsule<Others...>>
+                ::template UniPage<back[J]>...
+            >;
+        };
+
+        using type = Detail
+        <
+            std::make_index_sequence<front.size()>,
+            std::make_index_sequence<back.size()>
+        >::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,17 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_TOPOLOGICAL_SORT_H
+#define CONCEPTRODON_TYPELIVORE_TOPOLOGICAL_SORT_H
+
+#include "conceptrodon/metafunctions/typelivore/typical_topological_sort.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Nodes>
+using TopologicalSort = TypicalTopologicalSort<Nodes...>::type;
+
+}}
+
+#endif
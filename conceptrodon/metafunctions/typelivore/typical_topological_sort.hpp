@@ -0,0 +1,201 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_TYPICAL_TOPOLOGICAL_SORT_H
+#define CONCEPTRODON_TYPELIVORE_TYPICAL_TOPOLOGICAL_SORT_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/label.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/microbiota/typella/dependency.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/schedule.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+// Every step below works on all nodes at once.
+// Nothing recurses over the nodes, and no member template is instantiated per node.
+template<typename...Nodes>
+struct TypicalTopologicalSort
+{
+    static constexpr size_t length {sizeof...(Nodes)};
+
+    // Subsystems are located by their fingerprints in an open-addressing table.
+    // At least half of the slots stay empty, which keeps probes short.
+    static constexpr size_t capacity {std::bit_ceil(2 * length + 1)};
+
+    struct Table
+    {
+        std::array<uint64_t, capacity> keys {};
+
+        // Zero marks an empty slot. Otherwise, the slot holds the index plus one.
+        std::array<size_t, capacity> indices {};
+
+        constexpr auto find(uint64_t key) const -> size_t
+        {
+            size_t position {(key ^ (key >> 32)) & (capacity - 1)};
+
+            while (indices[position] != 0 && keys[position] != key)
+            { position = (position + 1) & (capacity - 1); }
+
+            return position;
+        }
+    };
+
+    // The first subsystem with a fingerprint claims the slot.
+    static constexpr Table table
+    {
+        []()
+        {
+            std::array<uint64_t, length> keys {Typella::Dependency<Nodes>::key...};
+            Table result {};
+
+            for (size_t i {0}; i < length; i++)
+            {
+                size_t position {result.find(keys[i])};
+
+                if (result.indices[position] == 0)
+                {
+                    result.keys[position] = keys[i];
+                    result.indices[position] = i + 1;
+                }
+            }
+
+            return result;
+        }()
+    };
+
+    // A subsystem fails to claim its own slot
+    // if it is listed twice or shares its fingerprint with another subsystem.
+    static constexpr bool unique
+    {
+        []()
+        {
+            std::array<uint64_t, length> keys {Typella::Dependency<Nodes>::key...};
+
+            for (size_t i {0}; i < length; i++)
+            {
+                if (table.indices[table.find(keys[i])] != i + 1)
+                { return false; }
+            }
+
+            return true;
+        }()
+    };
+
+    // Once the fingerprints of the subsystems are unique,
+    // a listed dependency is located at the subsystem itself.
+    // The roster is only built for unique subsystems,
+    // since a repeated base class is ill-formed.
+    using Roster = std::conditional_t
+    <
+        unique,
+        Typella::Roster<typename Typella::Dependency<Nodes>::type...>,
+        Capsule<>
+    >;
+
+    static constexpr bool complete
+    {
+        []()
+        {
+            std::array<bool, length> listed {Typella::Dependency<Nodes>::template listed<Roster>...};
+
+            for (bool item : listed)
+            {
+                if (not item)
+                { return false; }
+            }
+
+            return true;
+        }()
+    };
+
+    // The dependencies of all nodes are stored back to back.
+    static constexpr auto starts
+    {
+        []()
+        {
+            std::array<size_t, length> sizes {Typella::Dependency<Nodes>::size...};
+            std::array<size_t, length + 1> result {};
+
+            for (size_t i {0}; i < length; i++)
+            { result[i + 1] = result[i] + sizes[i]; }
+
+            return result;
+        }()
+    };
+
+    static constexpr size_t edges {starts[length]};
+
+    // A missing dependency is located at `size_t(-1)`, which `Ominuci::schedule` ignores.
+    static constexpr auto targets
+    {
+        []()
+        {
+            std::array<uint64_t const *, length> lists {Typella::Dependency<Nodes>::keys.data()...};
+            std::array<size_t, edges> result {};
+
+            for (size_t i {0}; i < length; i++)
+            {
+                for (size_t k {starts[i]}; k < starts[i + 1]; k++)
+                { result[k] = table.indices[table.find(lists[i][k - starts[i]])] - 1; }
+            }
+
+            return result;
+        }()
+    };
+
+    static constexpr auto schedule {Ominuci::schedule<length, edges>(starts, targets)};
+
+    static_assert
+    (
+        unique,
+        "Conceptrodon::Typelivore::TopologicalSort: every subsystem must be listed exactly once."
+    );
+
+    static_assert
+    (
+        not unique || complete,
+        "Conceptrodon::Typelivore::TopologicalSort: every dependency must be listed as a subsystem."
+    );
+
+    static_assert
+    (
+        not unique || not complete || schedule.size == length,
+        "Conceptrodon::Typelivore::TopologicalSort: the dependency graph contains a cycle."
+    );
+
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        struct Directory
+        : public Label<Tyy<typename Typella::Dependency<Nodes>::type>, std::integral_constant<size_t, I>>... {};
+
+        // The subsystem is deduced from the base class that carries the index.
+        template<size_t Index, typename Subsystem>
+        static consteval auto pick(Label<Tyy<Subsystem>, std::integral_constant<size_t, Index>> const *)
+        -> Tyy<Subsystem>;
+
+        // Nodes left out by a cycle are filled with the zeroth subsystem,
+        // which keeps the diagnostic to the assertion above.
+        using type = Capsule
+        <
+            typename decltype(pick<schedule.order[I]>(static_cast<Directory const *>(nullptr)))::type...
+        >;
+    };
+
+    using type = Detail<std::make_index_sequence<length>>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNION_H
+#define CONCEPTRODON_TYPELIVORE_UNION_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/lineup.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Union
+{
+    struct Inspector
+    : public Tyy<Elements>... {};
+
+    template<typename...Others>
+    struct ProtoMold
+    {
+        // Indices of the arguments absent from `Elements`.
+        static constexpr auto kept
+        {Ominuci::sift<not std::is_base_of_v<Tyy<Others>, Inspector>...>};
+
+        template<typename>
+        struct Detail {};
+
+        template<size_t...I>
+        struct Detail<std::index_sequence<I...>>
+        {
+            using type = Capsule
+            <
+                Elements...,
+                typename Ominuci::Lineup<Capsule<Others...>>
+                ::template UniPage<kept[I]>...
+            >;
+        };
+
+        using type = Detail<std::make_index_sequence<kept.size()>>::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>::type;
+};
+
+}}
+
+#endif
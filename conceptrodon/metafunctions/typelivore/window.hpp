@@ -0,0 +1,48 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_WINDOW_H
+#define CONCEPTRODON_TYPELIVORE_WINDOW_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/tyy.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/tessellate.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+
+template<typename...Elements>
+struct Window
+{
+    template<auto...>
+    struct ProtoPage {};
+
+    template<auto Size, auto Stride>
+    struct ProtoPage<Size, Stride>
+    {
+        static_assert
+        (
+            0 < Size && 0 < Stride,
+            "Conceptrodon::Typelivore::Window: size and stride must be positive."
+        );
+
+        using type = Ominuci::Tessellate
+        <
+            Ominuci::Tiling<sizeof...(Elements), Size, Stride, false>,
+            Ominuci::Unwrap
+        >
+        ::template Detail<Capsule<Tyy<Elements>...>>::type;
+    };
+
+    // Without a stride, windows slide by one.
+    template<auto Size>
+    struct ProtoPage<Size>
+    : public ProtoPage<Size, 1> {};
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_ALIGNED_SCAN_H
+#define CONCEPTRODON_VARYBIVORE_ALIGNED_SCAN_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/metafunctions/microbiota/varbola/unfold.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Sizes>
+struct AlignedScan
+{
+    template<auto...Alignments>
+    struct ProtoPage
+    {
+        static_assert
+        (
+            sizeof...(Alignments) == sizeof...(Sizes),
+            "Conceptrodon::Varybivore::AlignedScan: every size requires an alignment."
+        );
+
+        static_assert
+        (
+            ((0 < Alignments) && ...),
+            "Conceptrodon::Varybivore::AlignedScan: alignments must be positive."
+        );
+
+        // Each offset is the end of the previous element,
+        // rounded up to a multiple of the alignment of the current one.
+        static constexpr auto offsets = []()
+        {
+            std::array<size_t, sizeof...(Sizes)> sizes {static_cast<size_t>(Sizes)...};
+            std::array<size_t, sizeof...(Sizes)> alignments
+            {static_cast<size_t>(Alignments)...};
+            std::array<size_t, sizeof...(Sizes)> offsets {};
+            size_t offset {0};
+
+            for (size_t i {0}; i < sizes.size(); i++)
+            {
+                offset = (offset + alignments[i] - 1) / alignments[i] * alignments[i];
+                offsets[i] = offset;
+                offset += sizes[i];
+            }
+
+            return offsets;
+        }();
+
+        using type = Varbola::Unfold
+        <offsets, std::make_index_sequence<sizeof...(Sizes)>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
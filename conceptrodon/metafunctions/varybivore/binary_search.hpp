@@ -0,0 +1,33 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_BINARY_SEARCH_H
+#define CONCEPTRODON_VARYBIVORE_BINARY_SEARCH_H
+
+#include "conceptrodon/metafunctions/microbiota/varbola/ascent.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/binary_search.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct BinarySearch
+: public Varbola::BinarySearch<Varbola::Ascent<Variables...>::value> {};
+
+template<>
+struct BinarySearch<>
+{
+    template<auto Inspecting>
+    struct ProtoPage
+    { static constexpr bool value {false}; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Inspecting>
+    static constexpr bool Page_v {false};
+};
+
+}}
+
+#endif
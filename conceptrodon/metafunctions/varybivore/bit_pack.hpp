@@ -0,0 +1,25 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_BIT_PACK_H
+#define CONCEPTRODON_VARYBIVORE_BIT_PACK_H
+
+#include "conceptrodon/metafunctions/microbiota/varbola/bits.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Phenomena>
+struct BitPack
+{
+    static constexpr Varbola::Bits<sizeof...(Phenomena)> value
+    {Varbola::pack<static_cast<bool>(Phenomena)...>()};
+};
+
+template<auto...Phenomena>
+constexpr Varbola::Bits<sizeof...(Phenomena)> BitPack_v
+{Varbola::pack<static_cast<bool>(Phenomena)...>()};
+
+}}
+
+#endif
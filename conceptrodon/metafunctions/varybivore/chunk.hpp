@@ -0,0 +1,43 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_CHUNK_H
+#define CONCEPTRODON_VARYBIVORE_CHUNK_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/tessellate.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Chunk
+{
+    template<auto...>
+    struct ProtoPage {};
+
+    template<auto Size>
+    struct ProtoPage<Size>
+    {
+        static_assert
+        (
+            0 < Size,
+            "Conceptrodon::Varybivore::Chunk: size must be positive."
+        );
+
+        using type = Ominuci::Tessellate
+        <
+            Ominuci::Tiling<sizeof...(Variables), Size, Size, true>,
+            Ominuci::Unveil
+        >
+        ::template Detail<Capsule<Vay<Variables>...>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
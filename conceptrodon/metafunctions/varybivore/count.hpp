@@ -0,0 +1,46 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_COUNT_H
+#define CONCEPTRODON_VARYBIVORE_COUNT_H
+
+#include <cstddef>
+#include <type_traits>
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/varybivore/histogram.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Count
+{
+    // The tally is shared by every query.
+    using Census = Histogram<Variables...>;
+
+    using Inspector = Census::template Inspector<typename Census::Distinct>;
+
+    template<auto Inspecting>
+    struct ProtoPage
+    {
+        static constexpr size_t value
+        {Census::tally.count(Census::template key<Inspecting>)};
+
+        // A found fingerprint must belong to `Inspecting` itself.
+        static_assert
+        (
+            value == 0 || std::is_base_of_v<Vay<Inspecting>, Inspector>,
+            "Conceptrodon::Varybivore::Count: fingerprint collision detected."
+        );
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Inspecting>
+    static constexpr size_t Page_v {ProtoPage<Inspecting>::value};
+};
+
+}}
+
+#endif
@@ -0,0 +1,33 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_EQUAL_RANGE_H
+#define CONCEPTRODON_VARYBIVORE_EQUAL_RANGE_H
+
+#include <cstddef>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/ascent.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/equal_range.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct EqualRange
+: public Varbola::EqualRange<Varbola::Ascent<Variables...>::value> {};
+
+// Without variables, every range is empty.
+template<>
+struct EqualRange<>
+{
+    template<auto Target>
+    struct ProtoPage
+    { using type = Shuttle<size_t{0}, size_t{0}>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
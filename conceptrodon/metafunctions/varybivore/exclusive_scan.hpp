@@ -0,0 +1,73 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_EXCLUSIVE_SCAN_H
+#define CONCEPTRODON_VARYBIVORE_EXCLUSIVE_SCAN_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/conformable.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/unfold.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct ExclusiveScan
+{
+    // The variables are converted to their common type.
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (Varbola::conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    template<auto Init, auto Operation = std::plus<> {}>
+    struct ProtoPage
+    {
+        // The `I`th total combines `Init` with the first `I` variables.
+        static constexpr auto totals = []()
+        {
+            std::array<value_type, sizeof...(Variables)> variables
+            {static_cast<value_type>(Variables)...};
+            std::array<decltype(Init), sizeof...(Variables)> totals {};
+            auto total {Init};
+
+            for (size_t i {0}; i < variables.size(); i++)
+            {
+                totals[i] = total;
+                total = Operation(total, variables[i]);
+            }
+
+            return totals;
+        }();
+
+        using type = Varbola::Unfold
+        <totals, std::make_index_sequence<sizeof...(Variables)>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+// Without variables, there is nothing to accumulate.
+template<>
+struct ExclusiveScan<>
+{
+    template<auto Init, auto Operation = std::plus<> {}>
+    struct ProtoPage
+    { using type = Shuttle<>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
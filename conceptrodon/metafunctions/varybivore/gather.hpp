@@ -0,0 +1,39 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_GATHER_H
+#define CONCEPTRODON_VARYBIVORE_GATHER_H
+
+#include <cstddef>
+#include "conceptrodon/metafunctions/varybivore/amid.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Gather
+{
+    // Every lookup resolves against the same overload set.
+    using Map = Amid<Variables...>;
+
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Variables)) && ...)
+    struct ProtoPage
+    {
+        template<template<auto...> class Operation>
+        struct Detail
+        {
+            using type = Operation<Map::template Page_v<Indices>...>;
+        };
+
+        template<template<auto...> class...Agreements>
+        using Rail = Detail<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_HISTOGRAM_H
+#define CONCEPTRODON_VARYBIVORE_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+#include "conceptrodon/metafunctions/sequnivore/typical_paste.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/tally.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Histogram
+{
+    // The type is fingerprinted alongside the value
+    // since compilers may print `1` and `1u` alike.
+    template<auto Variable>
+    static constexpr uint64_t key
+    {Typelivore::Fingerprint<Capsule<decltype(Variable), Vay<Variable>>>::value};
+
+    static constexpr auto tally
+    {Ominuci::tally<key<Variables>...>};
+
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        using Distinct = Sequnivore::TypicalPaste
+        <
+            Shuttle<>,
+            std::conditional_t<tally.firsts[I], Shuttle<Variables>, Shuttle<>>...
+        >::type;
+    };
+
+    template<typename>
+    struct Hidden {};
+
+    template<size_t...I>
+    struct Hidden<std::index_sequence<I...>>
+    { using Counts = Shuttle<tally.counts[I]...>; };
+
+    template<typename>
+    struct Inspector {};
+
+    template<auto...DistinctVariables>
+    struct Inspector<Shuttle<DistinctVariables...>>
+    : public Vay<DistinctVariables>... {};
+
+    using Distinct = Detail<std::make_index_sequence<sizeof...(Variables)>>::Distinct;
+
+    using Counts = Hidden<std::make_index_sequence<tally.size>>::Counts;
+
+    // A variable missing from `Distinct` shares its fingerprint
+    // with a different variable.
+    static_assert
+    (
+        (...&&std::is_base_of_v<Vay<Variables>, Inspector<Distinct>>),
+        "Conceptrodon::Varybivore::Histogram: fingerprint collision detected."
+    );
+
+    using type = Capsule<Distinct, Counts>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_INTERSECTION_H
+#define CONCEPTRODON_VARYBIVORE_INTERSECTION_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/varybivore/amid.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Intersection
+{
+    template<auto...Others>
+    struct ProtoPage
+    {
+        struct Inspector
+        : public Vay<Others>... {};
+
+        // Indices of the variables present in the arguments.
+        static constexpr auto kept
+        {Ominuci::sift<std::is_base_of_v<Vay<Variables>, Inspector>...>};
+
+        template<typename>
+        struct Detail {};
+
+        template<size_t...I>
+        struct Detail<std::index_sequence<I...>>
+        {
+            using type = Shuttle
+            <
+                Amid<Variables...>
+                ::template Page_v<kept[I]>...
+            >;
+        };
+
+        using type = Detail<std::make_index_sequence<kept.size()>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_KINDRED_FIND_ALL_H
+#define CONCEPTRODON_VARYBIVORE_KINDRED_FIND_ALL_H
+
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct KindredFindAll
+{
+    template<template<auto...> class...Predicates>
+    struct ProtoRail
+    {
+        template<auto Variable>
+        struct Detail
+        { static constexpr bool value {(...&&static_cast<bool>(Predicates<Variable>::value))}; };
+
+        // Every predicate is evaluated once per variable.
+        static constexpr auto value
+        {Ominuci::sift<Detail<Variables>::value...>};
+
+        template<typename>
+        struct Harvest {};
+
+        template<size_t...I>
+        struct Harvest<std::index_sequence<I...>>
+        { using type = Shuttle<value[I]...>; };
+
+        using type = Harvest<std::make_index_sequence<value.size()>>::type;
+    };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>::type;
+
+    template<template<auto...> class...Agreements>
+    static constexpr auto Rail_v
+    {ProtoRail<Agreements...>::value};
+};
+
+}}
+
+#endif
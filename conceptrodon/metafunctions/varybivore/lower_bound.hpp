@@ -0,0 +1,35 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_LOWER_BOUND_H
+#define CONCEPTRODON_VARYBIVORE_LOWER_BOUND_H
+
+#include <cstddef>
+#include "conceptrodon/metafunctions/microbiota/varbola/ascent.hpp"
+#include "conceptrodon/metafunctions/microbiota/varbola/lower_bound.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct LowerBound
+: public Varbola::LowerBound<Varbola::Ascent<Variables...>::value> {};
+
+// Without variables, every target belongs at the front.
+template<>
+struct LowerBound<>
+{
+    template<auto Target>
+    struct ProtoPage
+    { static constexpr size_t value {0}; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Target>
+    static constexpr size_t Page_v {0};
+};
+
+}}
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_MERGE_H
+#define CONCEPTRODON_VARYBIVORE_MERGE_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include "conceptrodon/metafunctions/microbiota/varbola/confluence.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+// Equivalent variables keep their relative order.
+template<auto...Variables>
+struct Merge
+{
+    template<auto Comparator>
+    struct Order
+    {
+        template<auto...Others>
+        struct ProtoPage
+        {
+            using type = Varbola::Confluence
+            <
+                Comparator,
+                false,
+                std::array<size_t, 2> {sizeof...(Variables), sizeof...(Others)},
+                Variables...,
+                Others...
+            >::type;
+        };
+
+        template<auto...Agreements>
+        using Page = ProtoPage<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = Order<std::ranges::less {}>::template Page<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,84 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_RANGE_H
+#define CONCEPTRODON_VARYBIVORE_RANGE_H
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/metafunctions/microbiota/varbola/lazy.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto Start, auto Stop, auto Step = 1>
+requires std::integral<std::common_type_t<decltype(Start), decltype(Stop), decltype(Step)>>
+&& (Step != 0)
+struct Range: public Varbola::Lazy<Range<Start, Stop, Step>>
+{
+    using value_type = std::common_type_t<decltype(Start), decltype(Stop), decltype(Step)>;
+
+    // Arithmetic is carried out in `value_type`.
+    // For unsigned types, a negative `Step` wraps around and still yields the right variables.
+    static constexpr value_type start {static_cast<value_type>(Start)};
+    static constexpr value_type step {static_cast<value_type>(Step)};
+
+    static constexpr size_t size()
+    {
+        if constexpr (0 < Step)
+        {
+            if (std::cmp_less(Start, Stop))
+            { return (static_cast<value_type>(Stop) - start + step - 1) / step; }
+        }
+
+        else
+        {
+            if (std::cmp_greater(Start, Stop))
+            {
+                return (start - static_cast<value_type>(Stop) - step - 1)
+                / static_cast<value_type>(-step);
+            }
+        }
+
+        return 0;
+    }
+
+    template<size_t Index>
+    static constexpr value_type Among_v {static_cast<value_type>(start + static_cast<value_type>(Index) * step)};
+
+    // `Bound_v<Index>` is a valid bound before the variable at `Index`.
+    // Past the last variable, `Among_v` may wrap around or overflow,
+    // so the original `Stop` is used instead.
+    template<size_t Index>
+    static constexpr value_type Bound_v {[]()
+    {
+        if constexpr (Index < size())
+        { return Among_v<Index>; }
+
+        else
+        { return static_cast<value_type>(Stop); }
+    }()};
+
+    // Slicing an arithmetic progression yields another one.
+    template<size_t...>
+    struct ProtoSlice {};
+
+    template<size_t Amount>
+    requires (Amount <= size())
+    struct ProtoSlice<Amount>
+    { using type = Range<Bound_v<Amount>, Bound_v<size()>, Step>; };
+
+    template<size_t Begin, size_t End>
+    requires (Begin <= End && End <= size())
+    struct ProtoSlice<Begin, End>
+    { using type = Range<Bound_v<Begin>, Bound_v<End>, Step>; };
+
+    template<size_t...Agreements>
+    using Slice = ProtoSlice<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,103 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_RUN_LENGTH_ENCODE_H
+#define CONCEPTRODON_VARYBIVORE_RUN_LENGTH_ENCODE_H
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/sequnivore/typical_paste.hpp"
+#include "conceptrodon/metafunctions/varybivore/solitary_is_same.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct RunLengthEncode
+{
+    // Never equal to any variable.
+    struct Sentinel {};
+
+    template<typename, typename>
+    struct Detail {};
+
+    // Each variable is compared with its successor
+    // by expanding the list against a copy shifted by one.
+    template<auto...Previous, auto...Current>
+    struct Detail<Shuttle<Previous...>, Shuttle<Current...>>
+    {
+        // `ends[I]` is true if a run ends right before `I`.
+        // The first entry compares `Sentinel` with the first variable,
+        // and the last entry closes the final run.
+        static constexpr std::array<bool, sizeof...(Current)> ends
+        {(not SolitaryIsSame<Previous, Current>::value)...};
+
+        struct Runs
+        {
+            std::array<size_t, sizeof...(Variables)> lengths {};
+            size_t size {0};
+        };
+
+        static constexpr Runs runs
+        {
+            []()
+            {
+                Runs result {};
+                size_t start {0};
+
+                for (size_t i {1}; i < sizeof...(Current); i++)
+                {
+                    if (ends[i])
+                    {
+                        result.lengths[result.size++] = i - start;
+                        start = i;
+                    }
+                }
+
+                return result;
+            }()
+        };
+
+        template<typename>
+        struct Hidden {};
+
+        template<size_t...I>
+        struct Hidden<std::index_sequence<I...>>
+        { using type = Shuttle<runs.lengths[I]...>; };
+
+        // The last variable of each run represents the run.
+        using Distinct = Sequnivore::TypicalPaste
+        <
+            Shuttle<>,
+            std::conditional_t
+            <
+                SolitaryIsSame<Previous, Current>::value
+                || SolitaryIsSame<Previous, Sentinel{}>::value,
+                Shuttle<>,
+                Shuttle<Previous>
+            >...
+        >::type;
+
+        using Counts = Hidden<std::make_index_sequence<runs.size>>::type;
+    };
+
+    using Encoding = Detail
+    <
+        Shuttle<Sentinel{}, Variables...>,
+        Shuttle<Variables..., Sentinel{}>
+    >;
+
+    using Distinct = Encoding::Distinct;
+
+    using Counts = Encoding::Counts;
+
+    using type = Capsule<Distinct, Counts>;
+};
+
+}}
+
+#endif
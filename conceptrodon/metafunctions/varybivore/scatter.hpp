@@ -0,0 +1,83 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_SCATTER_H
+#define CONCEPTRODON_VARYBIVORE_SCATTER_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "conceptrodon/metafunctions/varybivore/amid.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Scatter
+{
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Variables)) && ...)
+    struct ProtoPage
+    {
+        // `slots[I]` is one past the position of the replacement for `Variables[I]`,
+        // or zero if `Variables[I]` is kept.
+        // A later index overwrites an earlier one.
+        static constexpr auto slots
+        {
+            []()
+            {
+                std::array<size_t, sizeof...(Variables)> slots {};
+                size_t slot {};
+                ((slots[Indices] = ++slot), ...);
+                return slots;
+            }()
+        };
+
+        struct Slash
+        {
+            template<auto...Replacements>
+            requires (sizeof...(Replacements) == sizeof...(Indices))
+            struct ProtoPage
+            {
+                template<size_t Slot, auto Variable>
+                struct Pick
+                {
+                    static constexpr auto value
+                    {Amid<Replacements...>::template Page_v<Slot - 1>};
+                };
+
+                template<auto Variable>
+                struct Pick<0, Variable>
+                {
+                    static constexpr auto value {Variable};
+                };
+
+                template<template<auto...> class Operation, typename>
+                struct Detail {};
+
+                template<template<auto...> class Operation, size_t...I>
+                struct Detail<Operation, std::index_sequence<I...>>
+                {
+                    using type = Operation<Pick<slots[I], Variables>::value...>;
+                };
+
+                template<template<auto...> class...Agreements>
+                using Rail = Detail
+                <
+                    Agreements...,
+                    std::make_index_sequence<sizeof...(Variables)>
+                >::type;
+            };
+        };
+
+        template<auto...Agreements>
+        using Page = Slash::template ProtoPage<Agreements...>;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+}}
+
+#endif
@@ -0,0 +1,66 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_SYMMETRIC_DIFFERENCE_H
+#define CONCEPTRODON_VARYBIVORE_SYMMETRIC_DIFFERENCE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/varybivore/amid.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct SymmetricDifference
+{
+    struct Inspector
+    : public Vay<Variables>... {};
+
+    template<auto...Others>
+    struct ProtoPage
+    {
+        struct Examiner
+        : public Vay<Others>... {};
+
+        // Indices of the variables absent from the arguments.
+        static constexpr auto front
+        {Ominuci::sift<not std::is_base_of_v<Vay<Variables>, Examiner>...>};
+
+        // Indices of the arguments absent from `Variables`.
+        static constexpr auto back
+        {Ominuci::sift<not std::is_base_of_v<Vay<Others>, Inspector>...>};
+
+        template<typename, typename>
+        struct Detail {};
+
+        template<size_t...I, size_t...J>
+        struct Detail<std::index_sequence<I...>, std::index_sequence<J...>>
+        {
+            using type = Shuttle
+            <
+                Amid<Variables...>
+                ::template Page_v<front[I]>...,
+                Amid<Others...>
+                ::template Page_v<back[J]>...
+            >;
+        };
+
+        using type = Detail
+        <
+            std::make_index_sequence<front.size()>,
+            std::make_index_sequence<back.size()>
+        >::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNION_H
+#define CONCEPTRODON_VARYBIVORE_UNION_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/varybivore/amid.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/sift.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Union
+{
+    struct Inspector
+    : public Vay<Variables>... {};
+
+    template<auto...Others>
+    struct ProtoPage
+    {
+        // Indices of the arguments absent from `Variables`.
+        static constexpr auto kept
+        {Ominuci::sift<not std::is_base_of_v<Vay<Others>, Inspector>...>};
+
+        template<typename>
+        struct Detail {};
+
+        template<size_t...I>
+        struct Detail<std::index_sequence<I...>>
+        {
+            using type = Shuttle
+            <
+                Variables...,
+                Amid<Others...>
+                ::template Page_v<kept[I]>...
+            >;
+        };
+
+        using type = Detail<std::make_index_sequence<kept.size()>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,48 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_WINDOW_H
+#define CONCEPTRODON_VARYBIVORE_WINDOW_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+#include "conceptrodon/metafunctions/microbiota/ominuci/tessellate.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+
+template<auto...Variables>
+struct Window
+{
+    template<auto...>
+    struct ProtoPage {};
+
+    template<auto Size, auto Stride>
+    struct ProtoPage<Size, Stride>
+    {
+        static_assert
+        (
+            0 < Size && 0 < Stride,
+            "Conceptrodon::Varybivore::Window: size and stride must be positive."
+        );
+
+        using type = Ominuci::Tessellate
+        <
+            Ominuci::Tiling<sizeof...(Variables), Size, Stride, false>,
+            Ominuci::Unveil
+        >
+        ::template Detail<Capsule<Vay<Variables>...>>::type;
+    };
+
+    // Without a stride, windows slide by one.
+    template<auto Size>
+    struct ProtoPage<Size>
+    : public ProtoPage<Size, 1> {};
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+}}
+
+#endif
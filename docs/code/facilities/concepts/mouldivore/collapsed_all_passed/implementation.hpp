@@ -0,0 +1,36 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <type_traits>
+
+/**** Passed ****/
+template<template<typename...> class Predicate, typename...Elements>
+concept Passed = static_cast<bool>(Predicate<Elements...>::value);
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<template<typename...> class Predicate, typename...Elements>
+constexpr bool CollapsedAllPassed_v
+{(...&&Passed<Predicate, Elements>)};
+
+template<template<typename...> class Predicate, typename...Elements>
+concept CollapsedAllPassed = CollapsedAllPassed_v<Predicate, Elements...>;
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** fun ****/
+template<typename...Args>
+requires CollapsedAllPassed<std::is_integral, Args...>
+constexpr bool fun(){return true;}
+
+template<typename...Args>
+constexpr bool fun(){return false;}
+
+/**** Test ****/
+static_assert(fun<int, long>());
+static_assert(! fun<int, double>());
@@ -0,0 +1,33 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+/**** Passed ****/
+template<typename Predicate, auto...Variables>
+concept Passed = static_cast<bool>(Predicate{}(Variables...));
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename Predicate, auto...Variables>
+constexpr bool CollapsedAllPassed_v
+{(...&&Passed<Predicate, Variables>)};
+
+template<typename Predicate, auto...Variables>
+concept CollapsedAllPassed = CollapsedAllPassed_v<Predicate, Variables...>;
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Positive ****/
+struct Positive
+{
+    constexpr bool operator()(auto para)
+    { return para > 0; }
+};
+
+/**** Tests ****/
+static_assert(CollapsedAllPassed<Positive, 1, 2, 3>);
+static_assert(! CollapsedAllPassed<Positive, 0, 2, 3>);
@@ -0,0 +1,186 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** GetParameterTypes ****/
+template <typename>
+struct AnalyzerPrototype {};
+
+template <typename Ret, typename...Args>
+struct AnalyzerPrototype<Ret(Args...)>
+{
+    template<template<typename...> class Container>
+    using parameter_types = Container<Args...>;
+};
+
+template <typename Ret, typename...Args>
+struct AnalyzerPrototype<Ret(Args...) const>
+{
+    template<template<typename...> class Container>
+    using parameter_types = Container<Args...>;
+};
+
+template<typename Fn>
+struct Analyzer: public AnalyzerPrototype<Fn> {};
+
+template<typename MemFn, typename Structure>
+struct Analyzer<MemFn Structure::*>
+: public AnalyzerPrototype<MemFn> {};
+
+template<typename FO>
+requires requires {&FO::operator();}
+struct Analyzer<FO>
+: public Analyzer<decltype(&FO::operator())> {};
+
+template<template<typename...> class Container>
+struct GetParameterTypes
+{ 
+    template<typename...Args>
+    using Mold = Analyzer<Args...>::template parameter_types<Container>;
+};
+
+/**** sift ****/
+template<bool...Flags>
+constexpr auto sift
+{
+    []()
+    {
+        std::array<bool, sizeof...(Flags)> flags {Flags...};
+        std::array<size_t, (0 + ... + Flags)> indices {};
+        size_t counter {0};
+
+        for (size_t i {0}; i < sizeof...(Flags); i++)
+        {
+            if (flags[i])
+            { indices[counter++] = i; }
+        }
+
+        return indices;
+    }()
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Handlers>
+struct Dispatch
+{
+    template<typename, typename>
+    struct Accept
+    { static constexpr bool value {false}; };
+
+    template<typename Parameter, typename Event>
+    struct Accept<Capsule<Parameter>, Event>
+    { static constexpr bool value {std::is_same_v<std::remove_cvref_t<Parameter>, Event>}; };
+
+    template<typename...Events>
+    struct ProtoMold
+    {
+        using pointer_type = void(*)(std::variant<Events...> const&, Handlers&...);
+
+        template<typename Event>
+        static constexpr auto routes
+        {
+            sift
+            <
+                (
+                    Accept<typename GetParameterTypes<Capsule>::template Mold<Handlers>, Event>::value
+                    && std::is_invocable_v<Handlers&, Event const&>
+                )...
+            >
+        };
+
+        template<typename Event>
+        static constexpr void deliver(Event const& event, Handlers&...handlers)
+        {
+            [&]<size_t...I>(std::index_sequence<I...>)
+            {
+                auto handler_refs {std::tie(handlers...)};
+                (std::invoke(std::get<routes<Event>[I]>(handler_refs), event), ...);
+            }(std::make_index_sequence<routes<Event>.size()>{});
+        }
+
+        template<auto I>
+        struct Entry
+        {
+            static constexpr void invoke(std::variant<Events...> const& event, Handlers&...handlers)
+            { deliver(std::get<I>(event), handlers...); }
+        };
+
+        template<typename>
+        struct Table {};
+
+        template<size_t...I>
+        struct Table<std::index_sequence<I...>>
+        {
+            static constexpr std::array<pointer_type, sizeof...(Events)> value
+            {&Entry<I>::invoke...};
+        };
+
+        static constexpr auto value
+        {Table<std::make_index_sequence<sizeof...(Events)>>::value};
+
+        static constexpr void dispatch(std::variant<Events...> const& event, Handlers&...handlers)
+        {
+            if (event.valueless_by_exception())
+            { throw std::bad_variant_access {}; }
+
+            value[event.index()](event, handlers...);
+        }
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Events ****/
+struct Ping { int count; };
+struct Pong { int count; };
+
+/**** Handlers ****/
+struct Counter
+{
+    int total {0};
+    constexpr void operator()(Ping const& ping) { total += ping.count; }
+};
+
+struct Responder
+{
+    int total {0};
+    constexpr void operator()(Pong const& pong) { total += 10 * pong.count; }
+};
+
+/**** Metafunction ****/
+using Metafunction = Dispatch<Counter, Responder>::Mold<Ping, Pong>;
+
+/**** Tests ****/
+static_assert(Metafunction::routes<Ping>.size() == 1);
+static_assert(Metafunction::routes<Pong>[0] == 1);
+
+constexpr int test()
+{
+    Counter counter {};
+    Responder responder {};
+    Metafunction::dispatch(Ping{1}, counter, responder);
+    Metafunction::dispatch(Pong{2}, counter, responder);
+    return counter.total + responder.total;
+}
+
+static_assert(test() == 21);
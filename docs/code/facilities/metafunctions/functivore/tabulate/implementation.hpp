@@ -0,0 +1,96 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**** Vessels ****/
+template<typename...>
+struct Capsule;
+
+template<auto...>
+struct Shuttle;
+
+/**** Analyzer ****/
+template <typename>
+struct AnalyzerPrototype {};
+
+template <typename Ret, typename...Args>
+struct AnalyzerPrototype<Ret(Args...)>
+{
+    static constexpr std::uint32_t value {0};
+
+    using result_type = Ret;
+
+    template<template<typename...> class Container>
+    using parameter_types = Container<Args...>;
+};
+
+template <typename Ret, typename...Args>
+struct AnalyzerPrototype<Ret(Args...) noexcept>
+{
+    static constexpr std::uint32_t value {1 << 5};
+
+    using result_type = Ret;
+
+    template<template<typename...> class Container>
+    using parameter_types = Container<Args...>;
+};
+
+template<typename Fn>
+struct AnalyzerIntermediate: public AnalyzerPrototype<Fn> {};
+
+template<typename Fn>
+struct AnalyzerIntermediate<Fn*>
+: public AnalyzerPrototype<Fn> {};
+
+template<typename...Args>
+using Analyzer = AnalyzerIntermediate<std::remove_cvref_t<Args>...>;
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Analyses>
+struct Columns
+{
+    static constexpr size_t size {sizeof...(Analyses)};
+
+    using return_types = Capsule<typename Analyses::result_type...>;
+
+    using parameter_types = Capsule<typename Analyses::template parameter_types<Capsule>...>;
+
+    using flags = Shuttle<Analyses::value...>;
+};
+
+template<typename>
+struct Tabulate {};
+
+template
+<
+    template<typename...> class Container,
+    typename...Callables
+>
+struct Tabulate<Container<Callables...>>
+: public Columns<Analyzer<Callables>...> {};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** functions ****/
+inline int fun_0(int, int*){ return 0; }
+inline void fun_1(char) noexcept {}
+
+/**** Table ****/
+using Table = Tabulate<Capsule<decltype(fun_0), decltype(&fun_1)>>;
+
+/**** Tests ****/
+static_assert(Table::size == 2);
+static_assert(std::same_as<Table::return_types, Capsule<int, void>>);
+static_assert(std::same_as<Table::parameter_types, Capsule<Capsule<int, int*>, Capsule<char>>>);
+static_assert(std::same_as<Table::flags, Shuttle<std::uint32_t{0}, std::uint32_t{1 << 5}>>);
@@ -8,12 +8,35 @@ struct Disjunction
     template<typename...Elements>
     struct ProtoMold
     {
+        template<template<typename...> class...>
+        struct Detail
+        { static constexpr bool value {false}; };
+
+        template<template<typename...> class First, template<typename...> class...Others>
+        struct Detail<First, Others...>
+        {
+            static constexpr bool value
+            {
+                []()
+                {
+                    if constexpr (static_cast<bool>(First<Elements...>::value))
+                    { return true; }
+                    else
+                    { return Detail<Others...>::value; }
+                }()
+            };
+        };
+
         static constexpr bool value
-        {(...||Predicates<Elements...>::value)};
+        {Detail<Predicates...>::value};
     };
-    
+
     template<typename...Elements>
     using Mold = ProtoMold<Elements...>;
+
+    template<typename...Elements>
+    static constexpr bool Mold_v
+    {ProtoMold<Elements...>::value};
 };
 
 /*****************/
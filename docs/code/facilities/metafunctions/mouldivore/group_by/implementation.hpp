@@ -0,0 +1,166 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<typename...Elements>
+struct Paste<Capsule<Elements...>>
+{ using type = Capsule<Elements...>; };
+
+template<typename...LeftElements, typename...RightElements, typename...Others>
+struct Paste<Capsule<LeftElements...>, Capsule<RightElements...>, Others...>
+{ using type = Paste<Capsule<LeftElements..., RightElements...>, Others...>::type; };
+
+/**** Distribute ****/
+template<typename, auto Buckets, size_t Count>
+struct Distribute {};
+
+template<typename...Elements, auto Buckets, size_t Count>
+struct Distribute<Capsule<Elements...>, Buckets, Count>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        template<size_t B>
+        using Bucket = Paste
+        <
+            Capsule<>,
+            std::conditional_t<Buckets[I] == B, Capsule<Elements>, Capsule<>>...
+        >::type;
+
+        template<typename>
+        struct Hidden {};
+
+        template<size_t...B>
+        struct Hidden<std::index_sequence<B...>>
+        { using type = Capsule<Bucket<B>...>; };
+
+        using type = Hidden<std::make_index_sequence<Count>>::type;
+    };
+
+    using type = Detail<std::index_sequence_for<Elements...>>::type;
+};
+
+/**** Typelivore::GroupBy ****/
+namespace Typelivore {
+
+template<typename...Elements>
+struct GroupBy
+{
+    template<template<typename...> class KeyExtractor>
+    struct ProtoRoad
+    {
+        // Every key is extracted once.
+        // All keys are required to have the same type.
+        static constexpr std::array keys
+        {KeyExtractor<Elements>::value...};
+
+        using key_type = decltype(keys)::value_type;
+
+        struct Assignment
+        {
+            std::array<size_t, sizeof...(Elements)> buckets {};
+            size_t count {0};
+        };
+
+        // Groups are numbered in the order their keys first appear.
+        static constexpr Assignment assignment
+        {
+            []()
+            {
+                Assignment result {};
+                std::array<key_type, sizeof...(Elements)> seen {};
+
+                for (size_t i {0}; i < sizeof...(Elements); i++)
+                {
+                    size_t bucket {0};
+
+                    while (bucket < result.count && not (seen[bucket] == keys[i]))
+                    { bucket++; }
+
+                    if (bucket == result.count)
+                    { seen[result.count++] = keys[i]; }
+
+                    result.buckets[i] = bucket;
+                }
+
+                return result;
+            }()
+        };
+
+        using type = Distribute
+        <
+            Capsule<Elements...>,
+            assignment.buckets,
+            assignment.count
+        >::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+};
+
+// Without elements, there are no keys to compare.
+template<>
+struct GroupBy<>
+{
+    template<template<typename...> class KeyExtractor>
+    struct ProtoRoad
+    { using type = Capsule<>; };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+};
+
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<template<typename...> class KeyExtractor>
+struct GroupBy
+{
+    template<typename...Elements>
+    using Mold = Typelivore::GroupBy<Elements...>
+    ::template Road<KeyExtractor>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Size ****/
+template<typename Element>
+struct Size
+{ static constexpr auto value {sizeof(Element)}; };
+
+/**** Metafunction ****/
+using Metafunction = GroupBy<Size>::Mold<int, double, char, float, long long, bool>;
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule
+<
+    Capsule<int, float>,
+    Capsule<double, long long>,
+    Capsule<char, bool>
+>;
+
+/**** Test ****/
+static_assert(std::same_as<Metafunction, SupposedResult>);
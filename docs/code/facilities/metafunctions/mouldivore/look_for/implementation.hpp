@@ -5,29 +5,95 @@
 #include <type_traits>
 #include <cstddef>
 
-/************************/
-/**** Implementation ****/
-/************************/
+/**** Typelivore::KindredFind ****/
+namespace Typelivore {
 
-template<template<typename...> class Predicate>
-struct LookFor
+template<typename...>
+struct KindredFind
 {
-    template<typename...Elements>
-    struct ProtoMold
-    {
-        static constexpr auto value
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    { static constexpr auto value {-1}; };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>;
+};
+
+template<typename First>
+struct KindredFind<First>
+{
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    {   
+        static constexpr auto value 
+        {
+            []() -> std::make_signed_t<size_t>
+            {
+                if constexpr ((...&&Predicates<First>::value))
+                { return 0; }
+
+                else
+                { return -1; }
+            }()
+        };
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>;
+};
+
+template<typename First, typename Second, typename...Others>
+struct KindredFind<First, Second, Others...>
+{
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    {   
+        static constexpr auto value 
         {
             []() -> std::make_signed_t<size_t>
             {
-                std::make_signed_t<size_t> counter {-1};
-                return
-                (...||(++counter, static_cast<bool>(Predicate<Elements>::value))) ? 
-                counter : -1;
+                if constexpr
+                ((...&&Predicates<First>::value))
+                { return 0; }
+
+                else if constexpr
+                ((...&&Predicates<Second>::value))
+                { return 1; }
+
+                else if constexpr
+                (
+                    KindredFind<Others...>
+                    ::template ProtoRoad<Predicates...>
+                    ::value != -1
+                )
+                { 
+                    return 2 + KindredFind<Others...>
+                    ::template ProtoRoad<Predicates...>
+                    ::value; 
+                }
+
+                else
+                { return -1; }
             }()
         };
     };
-        template<typename...Elements>
-    using Mold = ProtoMold<Elements...>;
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>;
+};
+
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<template<typename...> class Predicate>
+struct LookFor
+{
+    template<typename...Elements>
+    using Mold = Typelivore::KindredFind<Elements...>
+    ::template Road<Predicate>;
 };
 
 /*****************/
@@ -0,0 +1,337 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+/**** Capsule ****/
+template<typename...Elements>
+struct Capsule
+{
+    static constexpr size_t size() { return sizeof...(Elements); }
+
+    template<template<typename...> class Container>
+    using UniRoad = Container<Elements...>;
+};
+
+/**** Moy ****/
+template<template<typename...> class Container>
+struct Moy
+{
+    template<typename...Elements>
+    using Mold = Container<Elements...>;
+};
+
+/**** Send ****/
+// Only vessels of types are covered in this example.
+template<typename>
+struct Send {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Send<Container<Elements...>>
+: public Capsule<Elements...> {};
+
+/**** TurnOver ****/
+template<typename, typename...>
+struct TurnOver {};
+
+template<typename...Reversed>
+struct TurnOver<Capsule<Reversed...>>
+{ using type = Capsule<Reversed...>; };
+
+template<typename...Reversed, typename First, typename...Others>
+struct TurnOver<Capsule<Reversed...>, First, Others...>
+: public TurnOver<Capsule<First, Reversed...>, Others...> {};
+
+/**** Conceal ****/
+template<template<typename...> class Operation>
+struct Conceal
+{
+    template<typename...Elements>
+    struct ProtoMold
+    { using type = Operation<Elements...>; };
+
+    template<typename...Elements>
+    using Mold = ProtoMold<Elements...>;
+};
+
+/**** Reveal ****/
+template<template<typename...> class Operation>
+struct Reveal
+{
+    template<typename...Elements>
+    using Mold = Operation<Elements...>::type;
+};
+
+/**** CognateReverse ****/
+template<template<typename...> class Operation>
+struct CognateReverse
+{
+    template<typename...Elements>
+    using Mold = TurnOver<Capsule<>, Elements...>::type
+    ::template UniRoad<Operation>;
+};
+
+/**** CognateTransform ****/
+// Only the transformation with a single hormone is covered in this example.
+template<template<typename...> class Operation>
+struct CognateTransform
+{
+    template<template<typename...> class...Puberty>
+    struct ProtoRoad
+    {
+        template<template<typename...> class Hormone>
+        struct Slash
+        {
+            template<typename Element>
+            struct Detail
+            { using type = Element; };
+
+            template<typename Element>
+            requires (...&&Puberty<Element>::value)
+            struct Detail<Element>
+            { using type = Hormone<Element>; };
+
+            template<typename...Elements>
+            using Mold = Operation<typename Detail<Elements>::type...>;
+
+            template<template<template<typename...> class, template<typename> class...> class Agent>
+            using Assemble = Agent<Operation, Detail>;
+        };
+
+        template<template<typename...> class Hormone>
+        using Road = Slash<Hormone>;
+    };
+
+    template<template<typename...> class...Puberty>
+    using Road = ProtoRoad<Puberty...>;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+/**** Faithful ****/
+// Aliases may filter or reorder their arguments.
+// Only class templates known to keep them opt in.
+template<template<typename...> class>
+struct Faithful
+{ static constexpr bool value {false}; };
+
+template<>
+struct Faithful<Capsule>
+{ static constexpr bool value {true}; };
+
+template<>
+struct Faithful<std::tuple>
+{ static constexpr bool value {true}; };
+
+/**** Assembly ****/
+template<template<typename...> class Operation, template<typename> class...Stations>
+struct Assembly
+{
+    template<typename Element, template<typename> class...>
+    struct Detail
+    { using type = Element; };
+
+    template
+    <
+        typename Element,
+        template<typename> class Station,
+        template<typename> class...Others
+    >
+    struct Detail<Element, Station, Others...>
+    : public Detail<typename Station<Element>::type, Others...> {};
+
+    template<typename...Elements>
+    using Mold = Operation<typename Detail<Elements, Stations...>::type...>;
+};
+
+/**** Normalize ****/
+template<typename Step>
+struct Normalize
+{ using type = Step; };
+
+template<typename Step>
+requires requires { typename Step::template Assemble<Assembly>; }
+struct Normalize<Step>
+{ using type = Step::template Assemble<Assembly>; };
+
+/**** Fuse ****/
+template<typename, typename>
+struct Fuse {};
+
+template<template<typename...> class Operation, typename Latter>
+struct Fuse<Conceal<Operation>, Latter>
+{ using type = Latter; };
+
+template<template<typename...> class Container, typename Latter>
+requires Faithful<Container>::value
+struct Fuse<Moy<Container>, Latter>
+{ using type = Latter; };
+
+template<template<typename...> class Former, template<typename...> class Latter>
+requires Faithful<Former>::value
+struct Fuse<CognateReverse<Former>, CognateReverse<Latter>>
+{ using type = Moy<Latter>; };
+
+template<template<typename...> class Former, template<typename...> class Latter>
+requires Faithful<Former>::value
+struct Fuse<CognateReverse<Former>, Moy<Latter>>
+{ using type = CognateReverse<Latter>; };
+
+template
+<
+    template<typename...> class Former,
+    template<typename> class...Stations,
+    template<typename...> class Latter
+>
+requires Faithful<Former>::value
+struct Fuse<Assembly<Former, Stations...>, Moy<Latter>>
+{ using type = Assembly<Latter, Stations...>; };
+
+template
+<
+    template<typename...> class Former,
+    template<typename> class...FormerStations,
+    template<typename...> class Latter,
+    template<typename> class...LatterStations
+>
+requires Faithful<Former>::value
+struct Fuse<Assembly<Former, FormerStations...>, Assembly<Latter, LatterStations...>>
+{ using type = Assembly<Latter, FormerStations..., LatterStations...>; };
+
+/**** Push ****/
+template<typename, typename>
+struct Push {};
+
+template<typename...Items, typename Step>
+struct Push<Capsule<Items...>, Step>
+{ using type = Capsule<Step, Items...>; };
+
+template<typename Top, typename...Items, typename Step>
+requires requires
+{
+    typename Fuse
+    <
+        typename Normalize<Top>::type,
+        typename Normalize<Step>::type
+    >::type;
+}
+struct Push<Capsule<Top, Items...>, Step>
+: public Push
+<
+    Capsule<Items...>,
+    typename Fuse
+    <
+        typename Normalize<Top>::type,
+        typename Normalize<Step>::type
+    >::type
+> {};
+
+/**** Scan ****/
+template<typename Stack, typename...>
+struct Scan
+{ using type = Stack; };
+
+template<typename Stack, typename Step, typename...Others>
+struct Scan<Stack, Step, Others...>
+: public Scan<typename Push<Stack, Step>::type, Others...> {};
+
+/**** Travel ****/
+template<typename...>
+struct Travel {};
+
+template<typename Step>
+struct Travel<Step>
+{
+    template<typename...Elements>
+    using Mold = Step::template Mold<Elements...>;
+};
+
+template<typename Step, typename...Others>
+struct Travel<Step, Others...>
+{
+    template<typename...Elements>
+    using Mold = Send<typename Step::template Mold<Elements...>>
+    ::template UniRoad<Travel<Others...>::template Mold>;
+};
+
+/**** Streamline ****/
+template<typename First, typename...Others>
+struct Streamline
+{
+    template<typename...Reversed>
+    using TurnBack = TurnOver<Capsule<>, Reversed...>::type;
+
+    using type = Scan<Capsule<>, First, Others...>::type
+    ::template UniRoad<TurnBack>;
+
+    template<typename...Elements>
+    using Mold = type::template UniRoad<Travel>
+    ::template Mold<Elements...>;
+};
+
+/*******************/
+/**** Example 0 ****/
+/*******************/
+
+/**** Metafunction ****/
+using Metafunction = Streamline
+<
+    CognateReverse<std::tuple>,
+    CognateReverse<Capsule>
+>;
+
+/**** Tests ****/
+static_assert(std::same_as<Metafunction::type, Capsule<Moy<Capsule>>>);
+static_assert(std::same_as<Metafunction::Mold<int, char>, Capsule<int, char>>);
+
+/*******************/
+/**** Example 1 ****/
+/*******************/
+
+/**** IsInt ****/
+template<typename Element>
+struct IsInt
+: public std::is_same<Element, int> {};
+
+/**** IsPointer ****/
+template<typename Element>
+struct IsPointer
+: public std::is_pointer<Element> {};
+
+/**** AddPointer ****/
+template<typename Element>
+using AddPointer = Element*;
+
+/**** Metafunction ****/
+using Metafunction_1 = Streamline
+<
+    CognateTransform<std::tuple>::Road<IsInt>::Road<AddPointer>,
+    CognateTransform<Capsule>::Road<IsPointer>::Road<AddPointer>
+>;
+
+/**** Tests ****/
+static_assert(Metafunction_1::type::size() == 1);
+static_assert(std::same_as<Metafunction_1::Mold<int, char>, Capsule<int**, char>>);
+
+/*******************/
+/**** Example 2 ****/
+/*******************/
+
+/**** Operation ****/
+template<typename...Elements>
+struct Operation
+{ using type = std::tuple<Elements...>; };
+
+/**** Metafunction ****/
+// `Conceal` is followed by another step, so it is removed.
+using Metafunction_2 = Streamline<Conceal<Operation>, Reveal<Operation>>;
+
+/**** Tests ****/
+static_assert(std::same_as<Metafunction_2::type, Capsule<Reveal<Operation>>>);
+static_assert(std::same_as<Metafunction_2::Mold<int, char>, std::tuple<int, char>>);
@@ -0,0 +1,86 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstddef>
+#include <concepts>
+#include <tuple>
+
+template<typename...>
+struct Capsule;
+
+template<auto...>
+struct Shuttle;
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+enum class Kinds
+{
+    Unknown,
+    Mold, Page
+};
+
+template<typename>
+struct Kind
+{ static constexpr auto value {Kinds::Unknown}; };
+
+template
+<
+    template<typename...> class Container,
+    typename...Elements
+>
+struct Kind<Container<Elements...>>
+{
+    static constexpr auto value {Kinds::Mold};
+    static constexpr size_t size {sizeof...(Elements)};
+
+    using type = Capsule<Elements...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Mold<Elements...>;
+
+    template<typename...Agreements>
+    using Mold = Container<Agreements...>;
+};
+
+template
+<
+    template<auto...> class Sequence,
+    auto...Variables
+>
+struct Kind<Sequence<Variables...>>
+{
+    static constexpr auto value {Kinds::Page};
+    static constexpr size_t size {sizeof...(Variables)};
+
+    using type = Shuttle<Variables...>;
+
+    template<typename Operation>
+    using Relay = Operation::template Page<Variables...>;
+
+    template<auto...Agreements>
+    using Page = Sequence<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Operation ****/
+struct Operation
+{
+    template<auto...Variables>
+    using Page = Shuttle<Variables...>;
+};
+
+/**** Tests ****/
+static_assert(Kind<int>::value == Kinds::Unknown);
+static_assert(Kind<std::tuple<int, int*>>::value == Kinds::Mold);
+static_assert(Kind<std::tuple<int, int*>>::size == 2);
+static_assert(std::same_as<Kind<std::tuple<int, int*>>::type, Capsule<int, int*>>);
+static_assert(std::same_as<Kind<std::tuple<int>>::Mold<int*, int**>, std::tuple<int*, int**>>);
+
+static_assert(Kind<Shuttle<0, 1>>::value == Kinds::Page);
+static_assert(std::same_as<Kind<Shuttle<0, 1>>::Relay<Operation>, Shuttle<0, 1>>);
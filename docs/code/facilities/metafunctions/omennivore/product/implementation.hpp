@@ -0,0 +1,171 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy
+{ using type = Element; };
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{ 
+    static constexpr auto idyl(Key) -> Treasure;
+    static constexpr auto lark(Treasure) -> Key;
+};
+
+/**** Total ****/
+template<typename>
+struct Total {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Total<Container<Elements...>>
+{ static constexpr size_t value = sizeof...(Elements); };
+
+/**** unravel ****/
+template<size_t...Extents>
+consteval auto unravel(size_t index)
+{
+    std::array<size_t, sizeof...(Extents)> extents {Extents...};
+    std::array<size_t, sizeof...(Extents)> digits {};
+
+    for (size_t i {sizeof...(Extents)}; i != 0; i--)
+    {
+        digits[i - 1] = index % extents[i - 1];
+        index /= extents[i - 1];
+    }
+
+    return digits;
+}
+
+/**** Lineup ****/
+template<typename>
+struct Lineup {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Lineup<Container<Elements...>>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Tyy<Elements>, std::integral_constant<size_t, I>>...
+    { using Label<Tyy<Elements>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    using UniPage = decltype
+    (
+        Detail<std::index_sequence_for<Elements...>>
+        ::idyl(std::integral_constant<size_t, I>{})
+    )::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Packages>
+struct Product
+{
+    template<template<typename...> class Operation>
+    struct ProtoRoad
+    {
+        template<size_t I>
+        struct Detail
+        {
+            static constexpr auto digits
+            {unravel<Total<Packages>::value...>(I)};
+
+            template<typename>
+            struct Hidden {};
+
+            template<size_t...J>
+            struct Hidden<std::index_sequence<J...>>
+            {
+                using type = Operation
+                <typename Lineup<Packages>::template UniPage<digits[J]>...>;
+            };
+
+            using type = Hidden<std::index_sequence_for<Packages...>>::type;
+        };
+
+        template<auto...Agreements>
+        using Page = Detail<Agreements...>::type;
+
+        template<template<typename...> class OuterOperation>
+        struct Hidden
+        {
+            template<typename...>
+            struct Secret {};
+
+            template<size_t...I>
+            struct Secret<std::index_sequence<I...>>
+            { using type = OuterOperation<typename Detail<I>::type...>; };
+
+            using type = Secret
+            <std::make_index_sequence<(1 * ... * Total<Packages>::value)>>
+            ::type;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Hidden<Agreements...>::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>;
+
+    static constexpr size_t value {(1 * ... * Total<Packages>::value)};
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Containers ****/
+template<typename...>
+struct Con_0;
+
+template<typename...>
+struct Con_1;
+
+/**** Tuple ****/
+template<typename...>
+struct Tuple;
+
+/**** SupposedResult ****/
+using SupposedResult = Tuple<int*, void*>;
+
+/**** Result ****/
+using Result = Product<Con_0<int, int*>, Con_1<void, void*, void**>>
+::Road<Tuple>
+::Page<4>;
+
+/**** Test ****/
+static_assert(std::same_as<SupposedResult, Result>);
+
+/**** Collection ****/
+template<typename...>
+struct Collection;
+
+/**** SupposedResult ****/
+using SupposedResult_1 = Collection
+<
+    Tuple<int, void>, Tuple<int, void*>,
+    Tuple<int*, void>, Tuple<int*, void*>
+>;
+
+/**** Result ****/
+using Result_1 = Product<Con_0<int, int*>, Con_1<void, void*>>
+::Road<Tuple>
+::Road<Collection>;
+
+/**** Test ****/
+static_assert(std::same_as<SupposedResult_1, Result_1>);
@@ -0,0 +1,95 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstddef>
+#include <tuple>
+
+/**** Capsule ****/
+template<typename...Elements>
+struct Capsule
+{
+    template<template<typename...> class Container>
+    using UniRoad = Container<Elements...>;
+};
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<typename...Elements>
+struct Paste<Capsule<Elements...>>
+{ using type = Capsule<Elements...>; };
+
+template<typename...LeftElements, typename...RightElements, typename...Others>
+struct Paste<Capsule<LeftElements...>, Capsule<RightElements...>, Others...>
+{ using type = Paste<Capsule<LeftElements..., RightElements...>, Others...>::type; };
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+/**** Ravel ****/
+// Open the items packed in `Container`, at most `Levels` levels deep,
+// and collect the leaves into a `Capsule`.
+// Each node pastes the leaves of its items at once,
+// and the leaves are kept in `Capsule`s until the end.
+template<template<typename...> class Container>
+struct Ravel
+{
+    template<size_t, typename Item>
+    struct Detail
+    { using type = Capsule<Item>; };
+
+    template<size_t Levels, typename...Items>
+    requires (0 < Levels)
+    struct Detail<Levels, Container<Items...>>
+    {
+        using type = Paste
+        <Capsule<>, typename Detail<Levels - 1, Items>::type...>::type;
+    };
+};
+
+/**** TypicalFlatten ****/
+// Only vessels of types are covered in this example.
+template<typename, auto...>
+struct TypicalFlatten {};
+
+// Without a depth, every level is opened.
+template<typename Tree>
+struct TypicalFlatten<Tree>
+: public TypicalFlatten<Tree, static_cast<size_t>(-1)> {};
+
+template<template<typename...> class Container, typename...Items, auto Depth>
+struct TypicalFlatten<Container<Items...>, Depth>
+{
+    using type = Paste
+    <
+        Capsule<>,
+        typename Ravel<Container>::template Detail<Depth, Items>::type...
+    >
+    ::type::template UniRoad<Container>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+struct A; struct B; struct C; struct D;
+
+/**** Tree ****/
+using Tree = Capsule<Capsule<A, B>, C, Capsule<Capsule<D>>>;
+
+/**** Tests ****/
+static_assert(std::same_as<TypicalFlatten<Tree>::type, Capsule<A, B, C, D>>);
+static_assert(std::same_as<TypicalFlatten<Tree, 1>::type, Capsule<A, B, C, Capsule<D>>>);
+static_assert
+(
+    std::same_as
+    <
+        TypicalFlatten<std::tuple<std::tuple<A>, Capsule<B>, std::tuple<C, std::tuple<D>>>>::type,
+        std::tuple<A, Capsule<B>, C, D>
+    >
+);
@@ -0,0 +1,180 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+/**** Total ****/
+template<typename>
+struct Total {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Total<Container<Elements...>>
+{ static constexpr size_t value = sizeof...(Elements); };
+
+template<template<typename, auto...> class Sequence, typename Type, auto...Variables>
+struct Total<Sequence<Type, Variables...>>
+{ static constexpr size_t value = sizeof...(Variables); };
+
+/**** unravel ****/
+template<size_t...Extents>
+consteval auto unravel(size_t index)
+{
+    std::array<size_t, sizeof...(Extents)> extents {Extents...};
+    std::array<size_t, sizeof...(Extents)> digits {};
+
+    for (size_t i {sizeof...(Extents)}; i != 0; i--)
+    {
+        digits[i - 1] = index % extents[i - 1];
+        index /= extents[i - 1];
+    }
+
+    return digits;
+}
+
+/**** Product ****/
+// This simplified version only accepts `std::index_sequence`s
+// of the form `0, 1, ..., N-1`.
+// In this case, the digits are the items themselves.
+template<typename...Packages>
+struct Product
+{
+    template<template<auto...> class Operation>
+    struct ProtoRail
+    {
+        template<size_t I>
+        struct Detail
+        {
+            static constexpr auto digits
+            {unravel<Total<Packages>::value...>(I)};
+
+            template<typename>
+            struct Hidden {};
+
+            template<size_t...J>
+            struct Hidden<std::index_sequence<J...>>
+            { using type = Operation<digits[J]...>; };
+
+            using type = Hidden<std::index_sequence_for<Packages...>>::type;
+        };
+
+        template<template<typename...> class OuterOperation>
+        struct Hidden
+        {
+            template<typename...>
+            struct Secret {};
+
+            template<size_t...I>
+            struct Secret<std::index_sequence<I...>>
+            { using type = OuterOperation<typename Detail<I>::type...>; };
+
+            using type = Secret
+            <std::make_index_sequence<(1 * ... * Total<Packages>::value)>>
+            ::type;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Hidden<Agreements...>::type;
+    };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Variants>
+struct Visit
+{
+    template<typename Visitor>
+    struct ProtoMold
+    {
+        using result_type = std::invoke_result_t
+        <Visitor, decltype(std::get<0>(std::declval<Variants>()))...>;
+
+        using pointer_type = result_type(*)(Visitor&&, Variants&&...);
+
+        template<auto...I>
+        struct Entry
+        {
+            static constexpr result_type invoke(Visitor&& visitor, Variants&&...variants)
+            {
+                return std::invoke
+                (
+                    std::forward<Visitor>(visitor),
+                    std::get<I>(std::forward<Variants>(variants))...
+                );
+            }
+        };
+
+        template<typename...Entries>
+        struct Table
+        {
+            static constexpr std::array<pointer_type, sizeof...(Entries)> value
+            {&Entries::invoke...};
+        };
+
+        static constexpr auto value
+        {
+            Product<std::make_index_sequence<Total<std::remove_cvref_t<Variants>>::value>...>
+            ::template Rail<Entry>
+            ::template Road<Table>
+            ::value
+        };
+
+        static constexpr size_t index(std::remove_cvref_t<Variants> const&...variants)
+        {
+            size_t flat {0};
+            ((flat = flat * Total<std::remove_cvref_t<Variants>>::value + variants.index()), ...);
+            return flat;
+        }
+
+        static constexpr result_type visit(Visitor&& visitor, Variants&&...variants)
+        {
+            if ((...||(variants.index() >= Total<std::remove_cvref_t<Variants>>::value)))
+            { throw std::bad_variant_access {}; }
+
+            return value[index(variants...)]
+            (std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);
+        }
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Visitor ****/
+struct Visitor
+{
+    constexpr int operator()(int, float) const { return 0; }
+    constexpr int operator()(int, double) const { return 1; }
+    constexpr int operator()(char, float) const { return 2; }
+    constexpr int operator()(char, double) const { return 3; }
+};
+
+/**** Variants ****/
+using Variant_0 = std::variant<int, char>;
+using Variant_1 = std::variant<float, double>;
+
+/**** Metafunction ****/
+using Metafunction = Visit<Variant_0 const&, Variant_1 const&>
+::Mold<Visitor const&>;
+
+/**** Tests ****/
+constexpr Variant_0 variant_0 {'c'};
+constexpr Variant_1 variant_1 {1.0};
+
+static_assert(Metafunction::value.size() == 4);
+static_assert(Metafunction::index(variant_0, variant_1) == 3);
+static_assert(Metafunction::visit(Visitor{}, variant_0, variant_1) == 3);
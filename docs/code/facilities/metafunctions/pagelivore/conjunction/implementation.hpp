@@ -8,12 +8,35 @@ struct Conjunction
     template<auto...Variables>
     struct ProtoPage
     {
+        template<template<auto...> class...>
+        struct Detail
+        { static constexpr bool value {true}; };
+
+        template<template<auto...> class First, template<auto...> class...Others>
+        struct Detail<First, Others...>
+        {
+            static constexpr bool value
+            {
+                []()
+                {
+                    if constexpr (not First<Variables...>::value)
+                    { return false; }
+                    else
+                    { return Detail<Others...>::value; }
+                }()
+            };
+        };
+
         static constexpr bool value
-        {(...&&Predicates<Variables...>::value)};
+        {Detail<Predicates...>::value};
     };
-    
+
     template<auto...Variables>
     using Page = ProtoPage<Variables...>;
+
+    template<auto...Variables>
+    static constexpr bool Page_v
+    {ProtoPage<Variables...>::value};
 };
 
 /*****************/
@@ -8,12 +8,35 @@ struct Disjunction
     template<auto...Variables>
     struct ProtoPage
     {
+        template<template<auto...> class...>
+        struct Detail
+        { static constexpr bool value {false}; };
+
+        template<template<auto...> class First, template<auto...> class...Others>
+        struct Detail<First, Others...>
+        {
+            static constexpr bool value
+            {
+                []()
+                {
+                    if constexpr (static_cast<bool>(First<Variables...>::value))
+                    { return true; }
+                    else
+                    { return Detail<Others...>::value; }
+                }()
+            };
+        };
+
         static constexpr bool value
-        {(...||Predicates<Variables...>::value)};
+        {Detail<Predicates...>::value};
     };
-    
+
     template<auto...Variables>
     using Page = ProtoPage<Variables...>;
+
+    template<auto...Variables>
+    static constexpr bool Page_v
+    {ProtoPage<Variables...>::value};
 };
 
 /*****************/
@@ -0,0 +1,148 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Shuttle ****/
+template<auto...Variables>
+struct Shuttle
+{
+    template<template<auto...> class Sequence>
+    struct Detail { using type = Sequence<Variables...>; };
+
+    template<template<auto...> class...Sequences>
+    using Rail = Detail<Sequences...>::type;
+};
+
+/**** sift ****/
+template<bool...Flags>
+constexpr auto sift
+{
+    []()
+    {
+        std::array<bool, sizeof...(Flags)> flags {Flags...};
+        std::array<size_t, (0 + ... + Flags)> indices {};
+        size_t counter {0};
+
+        for (size_t i {0}; i < sizeof...(Flags); i++)
+        {
+            if (flags[i])
+            { indices[counter++] = i; }
+        }
+
+        return indices;
+    }()
+};
+
+/**** Gather ****/
+template<auto...Variables>
+struct Gather
+{
+    static constexpr std::array map {Variables...};
+
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Variables)) && ...)
+    struct ProtoPage
+    {
+        template<template<auto...> class Operation>
+        struct Detail
+        {
+            using type = Operation<map[Indices]...>;
+        };
+
+        template<template<auto...> class...Agreements>
+        using Rail = Detail<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+/**** Varybivore::KindredFindAll ****/
+namespace Varybivore {
+
+template<auto...Variables>
+struct KindredFindAll
+{
+    template<template<auto...> class...Predicates>
+    struct ProtoRail
+    {
+        template<auto Variable>
+        struct Detail
+        { static constexpr bool value {(...&&static_cast<bool>(Predicates<Variable>::value))}; };
+
+        // Every predicate is evaluated once per variable.
+        static constexpr auto value
+        {sift<Detail<Variables>::value...>};
+
+        template<typename>
+        struct Harvest {};
+
+        template<size_t...I>
+        struct Harvest<std::index_sequence<I...>>
+        { using type = Shuttle<value[I]...>; };
+
+        using type = Harvest<std::make_index_sequence<value.size()>>::type;
+    };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>::type;
+
+    template<template<auto...> class...Agreements>
+    static constexpr auto Rail_v
+    {ProtoRail<Agreements...>::value};
+};
+
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<template<auto...> class...Predicates>
+struct FindAll
+{
+    template<auto...Variables>
+    using Page = Varybivore::KindredFindAll<Variables...>
+    ::template Rail<Predicates...>;
+
+    template<auto...Variables>
+    static constexpr auto Page_v
+    {
+        Varybivore::KindredFindAll<Variables...>
+        ::template Rail_v<Predicates...>
+    };
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** IsEven ****/
+template<auto Variable>
+struct IsEven
+{ static constexpr bool value {Variable % 2 == 0}; };
+
+/**** Operation ****/
+template<auto...>
+struct Operation;
+
+/**** Metafunction ****/
+using Indices = FindAll<IsEven>
+::Page<1, 2, 3, 4>;
+
+/**** Tests ****/
+static_assert(std::same_as<Indices, Shuttle<size_t{1}, size_t{3}>>);
+static_assert
+(
+    std::same_as
+    <
+        Indices::Rail<Gather<1, 2, 3, 4>::Page>::Rail<Operation>,
+        Operation<2, 4>
+    >
+);
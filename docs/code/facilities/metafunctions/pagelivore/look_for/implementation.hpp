@@ -5,29 +5,95 @@
 #include <type_traits>
 #include <cstddef>
 
-/************************/
-/**** Implementation ****/
-/************************/
+/**** Varybivore::KindredFind ****/
+namespace Varybivore {
 
-template<template<auto...> class Predicate>
-struct LookFor
+template<auto...>
+struct KindredFind
 {
-    template<auto...Variables>
-    struct ProtoPage
-    {
-        static constexpr auto value
+    template<template<auto...> class...Predicates>
+    struct ProtoRail
+    { static constexpr auto value {-1}; };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>;
+};
+
+template<auto First>
+struct KindredFind<First>
+{
+    template<template<auto...> class...Predicates>
+    struct ProtoRail
+    {   
+        static constexpr auto value 
+        {
+            []() -> std::make_signed_t<size_t>
+            {
+                if constexpr ((...&&Predicates<First>::value))
+                { return 0; }
+
+                else
+                { return -1; }
+            }()
+        };
+    };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>;
+};
+
+template<auto First, auto Second, auto...Others>
+struct KindredFind<First, Second, Others...>
+{
+    template<template<auto...> class...Predicates>
+    struct ProtoRail
+    {   
+        static constexpr auto value 
         {
             []() -> std::make_signed_t<size_t>
             {
-                std::make_signed_t<size_t> counter {-1};
-                return
-                (...||( (++counter, Predicate<Variables>::value) ? true : false)) ? 
-                counter : -1;
+                if constexpr
+                ((...&&Predicates<First>::value))
+                { return 0; }
+
+                else if constexpr
+                ((...&&Predicates<Second>::value))
+                { return 1; }
+
+                else if constexpr
+                (
+                    KindredFind<Others...>
+                    ::template ProtoRail<Predicates...>
+                    ::value != -1
+                )
+                { 
+                    return 2 + KindredFind<Others...>
+                    ::template ProtoRail<Predicates...>
+                    ::value; 
+                }
+
+                else
+                { return -1; }
             }()
         };
     };
-        template<auto...Variables>
-    using Page = ProtoPage<Variables...>;
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>;
+};
+
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<template<auto...> class Predicate>
+struct LookFor
+{
+    template<auto...Variables>
+    using Page = Varybivore::KindredFind<Variables...>
+    ::template ProtoRail<Predicate>;
 };
 
 /*****************/
@@ -86,34 +86,66 @@ struct Press
 /**** Implementation ****/
 /************************/
 
-// We will use `Items` to keep track of user inputs.
-template<template<template<auto...> class...> class Operation, typename...Items>
+/**** Trail ****/
+// Each record only refers to the record before it.
+// Thus, extending a record never copies the earlier inputs.
+template<typename Earlier, typename Item>
+struct Trail {};
+
+// When the record is empty, the operation is returned as is.
+template<typename Operation, typename Record>
+struct Retrace
+{ using type = Operation; };
+
+template<typename Operation, typename Earlier, typename Item>
+struct Retrace<Operation, Trail<Earlier, Item>>
+{
+    // We first press the earlier inputs into the operation.
+    // Then, we press the last input.
+    using type = Omennivore::Press<typename Retrace<Operation, Earlier>::type>
+    ::template Mold<Item>;
+};
+
+/**** LoadSkip ****/
+// We will use `Record` to keep track of user inputs.
+// `void` stands for an empty record.
+template<template<template<auto...> class...> class Operation, typename Record = void>
 struct LoadSkip
 {
     // If `Mold` is selected, user inputs will be kept
-    // in a `Capsule` and placed at the end of `Items.`
-    // Then, we pass the extended `Items` back to `LoadSkip`,
+    // in a `Capsule` and linked to the end of `Record`.
+    // Then, we pass the extended `Record` back to `LoadSkip`,
     // waiting for more inputs.
     template<typename...Elements>
-    using Mold = LoadSkip<Operation, Items..., Capsule<Elements...>>;
+    struct ProtoMold
+    { using type = LoadSkip<Operation, Trail<Record, Capsule<Elements...>>>; };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>::type;
 
     // If `Page` is selected, user inputs will be kept
-    // in a `Shuttle` and placed at the end of `Items.`
-    // Then, we pass the extended `Items` back to `LoadSkip`,
+    // in a `Shuttle` and linked to the end of `Record`.
+    // Then, we pass the extended `Record` back to `LoadSkip`,
     // waiting for more inputs.
     template<auto...Variables>
-    using Page = LoadSkip<Operation, Items..., Shuttle<Variables...>>;
+    struct ProtoPage
+    { using type = LoadSkip<Operation, Trail<Record, Shuttle<Variables...>>>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
 
     struct Commit
     {
-        template<template<auto...> class...Sequences>
         // When finally initiating the operation, we invoke the skipped layer.
-        // Then, we pass the instantiated operation and user inputs
-        // to Omennivore::Press for further invocations.
-        using Rail = Omennivore::Press<Operation<Sequences...>>
-        ::template Mold<Items...>;
-    };
+        // Then, we pass the instantiated operation and the record
+        // to `Retrace` for further invocations.
+        template<template<auto...> class...Sequences>
+        struct ProtoRail
+        { using type = Retrace<Operation<Sequences...>, Record>::type; };
 
+        template<template<auto...> class...Agreements>
+        using Rail = ProtoRail<Agreements...>::type;
+    };
 };
 
 template<template<template<auto...> class...> class Operation>
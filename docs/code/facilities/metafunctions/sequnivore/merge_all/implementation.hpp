@@ -0,0 +1,216 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<auto...Variables>
+struct Paste<Shuttle<Variables...>>
+{ using type = Shuttle<Variables...>; };
+
+template<auto...LeftVariables, auto...RightVariables, typename...Others>
+struct Paste<Shuttle<LeftVariables...>, Shuttle<RightVariables...>, Others...>
+{ using type = Paste<Shuttle<LeftVariables..., RightVariables...>, Others...>::type; };
+
+/**** Unfold ****/
+template<auto const&, typename>
+struct Unfold {};
+
+// The variables are read through a reference,
+// so the expansion is instantiated without the pack of `Confluence`.
+template<auto const& Table, size_t...I>
+struct Unfold<Table, std::index_sequence<I...>>
+{ using type = Shuttle<Table[I]...>; };
+
+/**** conformable ****/
+template<typename Type, typename Variable>
+constexpr bool conformable(Variable variable)
+{
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Variable>)
+    {
+        return static_cast<Variable>(static_cast<Type>(variable)) == variable
+        && (static_cast<Type>(variable) < Type{}) == (variable < Variable{});
+    }
+
+    else
+    { return true; }
+}
+
+/**** Confluence ****/
+// Merge consecutive sorted runs of `Variables`.
+// `Runs` is an array holding the length of each run.
+// Neighbouring runs are merged pairwise until one run remains,
+// so the runs are merged in a single constant evaluation.
+// The variables are converted to their common type.
+template<auto Comparator, bool Unique, auto Runs, auto...Variables>
+struct Confluence
+{
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    using Array = std::array<value_type, sizeof...(Variables)>;
+
+    struct Outcome
+    {
+        Array values;
+        size_t size;
+        bool sorted;
+    };
+
+    static constexpr Outcome outcome = []()
+    {
+        Array values {static_cast<value_type>(Variables)...};
+        Array buffer {values};
+
+        // `bounds[I]` is where the `I`th run starts.
+        std::array<size_t, Runs.size() + 1> bounds {};
+        bool sorted {true};
+
+        for (size_t i {0}; i < Runs.size(); i++)
+        {
+            bounds[i + 1] = bounds[i] + Runs[i];
+            sorted = sorted && std::is_sorted
+            (values.begin() + bounds[i], values.begin() + bounds[i + 1], Comparator);
+        }
+
+        for (size_t count {Runs.size()}; count > 1; count = (count + 1) / 2)
+        {
+            for (size_t i {0}; i < count; i += 2)
+            {
+                if (i + 1 == count)
+                {
+                    std::copy
+                    (
+                        values.begin() + bounds[i],
+                        values.begin() + bounds[i + 1],
+                        buffer.begin() + bounds[i]
+                    );
+                    bounds[i / 2 + 1] = bounds[i + 1];
+                }
+
+                else
+                {
+                    // Ties are taken from the former run first,
+                    // which keeps the merge stable.
+                    std::merge
+                    (
+                        values.begin() + bounds[i],
+                        values.begin() + bounds[i + 1],
+                        values.begin() + bounds[i + 1],
+                        values.begin() + bounds[i + 2],
+                        buffer.begin() + bounds[i],
+                        Comparator
+                    );
+                    bounds[i / 2 + 1] = bounds[i + 2];
+                }
+            }
+
+            values = buffer;
+        }
+
+        size_t size {sizeof...(Variables)};
+
+        // Keep the first variable of every group of equivalent variables.
+        if constexpr (Unique)
+        {
+            size = 0;
+
+            for (size_t i {0}; i < sizeof...(Variables); i++)
+            {
+                if (size == 0 || Comparator(values[size - 1], values[i]))
+                { values[size++] = values[i]; }
+            }
+        }
+
+        return Outcome {values, size, sorted};
+    }();
+
+    static_assert
+    (
+        outcome.sorted,
+        "Conceptrodon::Varybivore: variables must be sorted with respect to the comparator."
+    );
+
+    static constexpr Array values {outcome.values};
+
+    using type = Unfold<values, std::make_index_sequence<outcome.size>>::type;
+};
+
+// Without variables, there is nothing to merge.
+template<auto Comparator, bool Unique, auto Runs>
+struct Confluence<Comparator, Unique, Runs>
+{ using type = Shuttle<>; };
+
+/**** TypicalMergeAll ****/
+template<typename...Sequences>
+struct TypicalMergeAll
+{
+    template<typename>
+    struct Span {};
+
+    template<template<auto...> class Sequence, auto...Variables>
+    struct Span<Sequence<Variables...>>
+    { static constexpr size_t value {sizeof...(Variables)}; };
+
+    template<typename>
+    struct Detail {};
+
+    template<auto...Variables>
+    struct Detail<Shuttle<Variables...>>
+    {
+        using type = Confluence
+        <
+            std::ranges::less {},
+            false,
+            std::array<size_t, sizeof...(Sequences)> {Span<Sequences>::value...},
+            Variables...
+        >::type;
+    };
+
+    using type = Detail<typename Paste<Shuttle<>, Sequences...>::type>::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Sequences>
+using MergeAll = TypicalMergeAll<Sequences...>::type;
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** SupposedResult ****/
+using SupposedResult = Shuttle<0, 1, 2, 3, 4, 5, 6>;
+
+/**** Result ****/
+using Result = MergeAll
+<
+    Shuttle<1, 4>,
+    Shuttle<2, 5>,
+    Shuttle<>,
+    Shuttle<0, 3, 6>
+>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
\ No newline at end of file
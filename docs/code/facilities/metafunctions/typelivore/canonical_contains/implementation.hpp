@@ -0,0 +1,275 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy
+{ using type = Element; };
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{
+    static constexpr auto idyl(Key) -> Treasure;
+    static constexpr auto lark(Treasure) -> Key;
+};
+
+/**** Lineup ****/
+template<typename>
+struct Lineup {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Lineup<Container<Elements...>>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Tyy<Elements>, std::integral_constant<size_t, I>>...
+    { using Label<Tyy<Elements>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    struct Hidden
+    {
+        using type = decltype
+        (
+            Detail<std::index_sequence_for<Elements...>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::type;
+    };
+
+    template<size_t I>
+    using UniPage = Hidden<I>::type;
+};
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Fingerprint ****/
+template<typename Element>
+consteval auto signify() -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+consteval auto digest(std::string_view signature) -> uint64_t
+{
+    uint64_t hash {14695981039346656037ULL};
+
+    for (char letter : signature)
+    {
+        hash ^= static_cast<unsigned char>(letter);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+template<typename Element>
+struct Fingerprint
+{ static constexpr uint64_t value {digest(signify<Element>())}; };
+
+/**** Canonicalize ****/
+template<typename...Elements>
+struct Canonicalize
+{
+    // Indices of the elements sorted by their fingerprints.
+    // Ties are broken by the original indices.
+    static constexpr auto order
+    {
+        []()
+        {
+            std::array<uint64_t, sizeof...(Elements)> fingerprints
+            {Fingerprint<Elements>::value...};
+            std::array<size_t, sizeof...(Elements)> indices {};
+
+            for (size_t i {0}; i < sizeof...(Elements); i++)
+            { indices[i] = i; }
+
+            std::ranges::sort
+            (
+                indices,
+                [&fingerprints](size_t i, size_t j)
+                {
+                    return fingerprints[i] < fingerprints[j]
+                    || (fingerprints[i] == fingerprints[j] && i < j);
+                }
+            );
+
+            return indices;
+        }()
+    };
+
+    // Positions in `order` whose fingerprints repeat the previous ones.
+    static constexpr size_t repetitions
+    {
+        []()
+        {
+            std::array<uint64_t, sizeof...(Elements)> fingerprints
+            {Fingerprint<Elements>::value...};
+            size_t counter {0};
+
+            for (size_t i {1}; i < sizeof...(Elements); i++)
+            {
+                if (fingerprints[order[i]] == fingerprints[order[i - 1]])
+                { counter++; }
+            }
+
+            return counter;
+        }()
+    };
+
+    template<bool Repetitive>
+    static constexpr auto partition
+    {
+        []()
+        {
+            std::array<uint64_t, sizeof...(Elements)> fingerprints
+            {Fingerprint<Elements>::value...};
+            std::array<size_t, Repetitive ? repetitions : sizeof...(Elements) - repetitions> result {};
+            size_t counter {0};
+
+            for (size_t i {0}; i < sizeof...(Elements); i++)
+            {
+                bool repeated {i != 0 && fingerprints[order[i]] == fingerprints[order[i - 1]]};
+
+                if (repeated == Repetitive)
+                { result[counter++] = Repetitive ? i : order[i]; }
+            }
+
+            return result;
+        }()
+    };
+
+    template<size_t I>
+    using Element = Lineup<Capsule<Elements...>>::template UniPage<I>;
+
+    template<typename, typename>
+    struct Detail {};
+
+    template<size_t...I, size_t...J>
+    struct Detail<std::index_sequence<I...>, std::index_sequence<J...>>
+    {
+        // Elements sharing a fingerprint must be the same type.
+        static_assert
+        (
+            (...&&std::is_same_v
+            <
+                Element<order[partition<true>[J]]>,
+                Element<order[partition<true>[J] - 1]>
+            >),
+            "Conceptrodon::Typelivore::Canonicalize: fingerprint collision detected."
+        );
+
+        template<template<typename...> class Operation>
+        using UniRoad = Operation<Element<partition<false>[I]>...>;
+    };
+
+    using Canonical = Detail
+    <
+        std::make_index_sequence<sizeof...(Elements) - repetitions>,
+        std::make_index_sequence<repetitions>
+    >;
+
+    template<template<typename...> class Operation>
+    struct Hidden
+    { using type = Canonical::template UniRoad<Operation>; };
+
+    template<template<typename...> class...Agreements>
+    using Road = Hidden<Agreements...>::type;
+
+    template<template<typename...> class Operation>
+    using UniRoad = Canonical::template UniRoad<Operation>;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct CanonicalContains
+{
+    template<typename...Canonicals>
+    struct Detail
+    {
+        static constexpr std::array<uint64_t, sizeof...(Canonicals)> fingerprints
+        {Fingerprint<Canonicals>::value...};
+
+        template<typename Inspecting>
+        static constexpr size_t position
+        {
+            static_cast<size_t>
+            (
+                std::ranges::lower_bound(fingerprints, Fingerprint<Inspecting>::value)
+                - fingerprints.begin()
+            )
+        };
+
+        template<typename Inspecting>
+        static consteval bool search()
+        {
+            if constexpr
+            (
+                position<Inspecting> != sizeof...(Canonicals)
+                && fingerprints[position<Inspecting>] == Fingerprint<Inspecting>::value
+            )
+            {
+                // Confirm the match so that a collision cannot produce a false positive.
+                return std::is_same_v
+                <
+                    Inspecting,
+                    typename Lineup<Capsule<Canonicals...>>
+                    ::template UniPage<position<Inspecting>>
+                >;
+            }
+
+            else
+            { return false; }
+        }
+    };
+
+    using Canonical = Canonicalize<Elements...>::template UniRoad<Detail>;
+
+    template<typename Inspecting>
+    struct ProtoMold
+    {
+        static constexpr bool value
+        {Canonical::template search<Inspecting>()};
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+
+    template<typename Inspecting>
+    static constexpr bool Mold_v
+    {Canonical::template search<Inspecting>()};
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<typename...Args>
+using Metafunction = CanonicalContains<int, int*, int, int**>
+::Mold<Args...>;
+
+/**** Tests ****/
+static_assert(Metafunction<int*>::value);
+static_assert(! Metafunction<void>::value);
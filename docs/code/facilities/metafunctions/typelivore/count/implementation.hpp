@@ -0,0 +1,226 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy
+{ using type = Element; };
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<typename...Elements>
+struct Paste<Capsule<Elements...>>
+{ using type = Capsule<Elements...>; };
+
+template<typename...LeftElements, typename...RightElements, typename...Others>
+struct Paste<Capsule<LeftElements...>, Capsule<RightElements...>, Others...>
+{ using type = Paste<Capsule<LeftElements..., RightElements...>, Others...>::type; };
+
+/**** Fingerprint ****/
+template<typename Element>
+consteval auto signify() -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+consteval auto digest(std::string_view signature) -> uint64_t
+{
+    uint64_t hash {14695981039346656037ULL};
+
+    for (char letter : signature)
+    {
+        hash ^= static_cast<unsigned char>(letter);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+template<typename Element>
+struct Fingerprint
+{ static constexpr uint64_t value {digest(signify<Element>())}; };
+
+/**** Tally ****/
+template<size_t Length>
+struct Tally
+{
+    // At least half of the slots stay empty, which keeps probes short.
+    static constexpr size_t capacity {std::bit_ceil(2 * Length + 1)};
+
+    std::array<uint64_t, capacity> slots {};
+
+    // Zero marks an empty slot.
+    std::array<size_t, capacity> multiplicities {};
+
+    // `firsts[I]` is true if the `I`th key has not appeared before.
+    std::array<bool, Length> firsts {};
+
+    // Multiplicities of the distinct keys in the order they first appear.
+    // Only the first `size` entries are used.
+    std::array<size_t, Length> counts {};
+
+    size_t size {0};
+
+    constexpr auto locate(uint64_t key) const -> size_t
+    {
+        size_t position {(key ^ (key >> 32)) & (capacity - 1)};
+
+        while (multiplicities[position] != 0 && slots[position] != key)
+        { position = (position + 1) & (capacity - 1); }
+
+        return position;
+    }
+
+    constexpr auto count(uint64_t key) const -> size_t
+    { return multiplicities[locate(key)]; }
+};
+
+/**** tally ****/
+template<uint64_t...Keys>
+constexpr auto tally
+{
+    []()
+    {
+        std::array<uint64_t, sizeof...(Keys)> keys {Keys...};
+        std::array<size_t, sizeof...(Keys)> positions {};
+        Tally<sizeof...(Keys)> result {};
+
+        for (size_t i {0}; i < sizeof...(Keys); i++)
+        {
+            positions[i] = result.locate(keys[i]);
+
+            if (result.multiplicities[positions[i]]++ == 0)
+            {
+                result.slots[positions[i]] = keys[i];
+                result.firsts[i] = true;
+            }
+        }
+
+        for (size_t i {0}; i < sizeof...(Keys); i++)
+        {
+            if (result.firsts[i])
+            { result.counts[result.size++] = result.multiplicities[positions[i]]; }
+        }
+
+        return result;
+    }()
+};
+
+/**** Histogram ****/
+template<typename...Elements>
+struct Histogram
+{
+    // Every fingerprint is computed once.
+    static constexpr auto tally
+    {::tally<Fingerprint<Elements>::value...>};
+
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        using Distinct = Paste
+        <
+            Capsule<>,
+            std::conditional_t<tally.firsts[I], Capsule<Elements>, Capsule<>>...
+        >::type;
+    };
+
+    template<typename>
+    struct Hidden {};
+
+    template<size_t...I>
+    struct Hidden<std::index_sequence<I...>>
+    { using Counts = Shuttle<tally.counts[I]...>; };
+
+    template<typename>
+    struct Inspector {};
+
+    template<typename...DistinctElements>
+    struct Inspector<Capsule<DistinctElements...>>
+    : public Tyy<DistinctElements>... {};
+
+    using Distinct = Detail<std::index_sequence_for<Elements...>>::Distinct;
+
+    using Counts = Hidden<std::make_index_sequence<tally.size>>::Counts;
+
+    // An element missing from `Distinct` shares its fingerprint
+    // with a different element.
+    static_assert
+    (
+        (...&&std::is_base_of_v<Tyy<Elements>, Inspector<Distinct>>),
+        "Conceptrodon::Typelivore::Histogram: fingerprint collision detected."
+    );
+
+    using type = Capsule<Distinct, Counts>;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct Count
+{
+    // The tally is shared by every query.
+    using Census = Histogram<Elements...>;
+
+    using Inspector = Census::template Inspector<typename Census::Distinct>;
+
+    template<typename Inspecting>
+    struct ProtoMold
+    {
+        static constexpr size_t value
+        {Census::tally.count(Fingerprint<Inspecting>::value)};
+
+        // A found fingerprint must belong to `Inspecting` itself.
+        static_assert
+        (
+            value == 0 || std::is_base_of_v<Tyy<Inspecting>, Inspector>,
+            "Conceptrodon::Typelivore::Count: fingerprint collision detected."
+        );
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+
+    template<typename Inspecting>
+    static constexpr size_t Mold_v {ProtoMold<Inspecting>::value};
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<typename...Args>
+using Metafunction = Count<int, float, int>::Mold<Args...>;
+
+/**** Tests ****/
+static_assert(Metafunction<int>::value == 2);
+static_assert(Metafunction<float>::value == 1);
+static_assert(Metafunction<void>::value == 0);
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstdint>
+#include <string_view>
+
+template<typename Element>
+consteval auto signify() -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+consteval auto digest(std::string_view signature) -> uint64_t
+{
+    uint64_t hash {14695981039346656037ULL};
+
+    for (char letter : signature)
+    {
+        hash ^= static_cast<unsigned char>(letter);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename Element>
+struct Fingerprint
+{ static constexpr uint64_t value {digest(signify<Element>())}; };
+
+template<typename Element>
+constexpr uint64_t Fingerprint_v {digest(signify<Element>())};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+static_assert(Fingerprint<int>::value != Fingerprint<int*>::value);
+static_assert(Fingerprint<int>::value == Fingerprint_v<int>);
@@ -0,0 +1,95 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstddef>
+#include <utility>
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy { using type = Element; };
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{ 
+    static constexpr auto idyl(Key) -> Treasure;
+};
+
+/**** Lineup ****/
+template<typename>
+struct Lineup {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Lineup<Container<Elements...>>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Tyy<Elements>, std::integral_constant<size_t, I>>...
+    { using Label<Tyy<Elements>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    struct Hidden
+    {
+        using type = decltype
+        (
+            Detail<std::index_sequence_for<Elements...>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::type;
+    };
+
+    template<size_t I>
+    using UniPage = Hidden<I>::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct Gather
+{
+    // Every lookup resolves against the same overload set.
+    using Map = Lineup<Capsule<Elements...>>;
+
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Elements)) && ...)
+    struct ProtoPage
+    {
+        template<template<typename...> class Operation>
+        struct Detail
+        {
+            using type = Operation<typename Map::template UniPage<Indices>...>;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Detail<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule<void, int, int>;
+
+/**** Result ****/
+using Result = Gather<int, int*, int**, void>
+::Page<3, 0, 0>
+::Road<Capsule>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
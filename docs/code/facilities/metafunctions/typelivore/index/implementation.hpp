@@ -0,0 +1,99 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <utility>
+#include <cstddef>
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{ 
+    static constexpr auto idyl(Key) -> Treasure;
+};
+
+/**** Amid ****/
+template<typename...Elements>
+struct Amid
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    // We create an overload set of `idyl` through inheritance.
+    : public Label<Elements, std::integral_constant<size_t, I>>...
+    {
+        // We bring every `idyl` from its base class to the current scope.
+        using Label<Elements, std::integral_constant<size_t, I>>::idyl...;
+    };
+
+    template<size_t I>
+    struct Hidden
+    {
+        // We ask the compiler to find an `idyl` that
+        // declares a parameter of type `std::integral_constant<size_t, I>`.
+        // If found, the return type of such `idyl` is the element
+        // of index I in the list.
+        using type = decltype
+        (
+            Detail<std::make_index_sequence<sizeof...(Elements)>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        );
+    };
+
+    template<auto...Agreements>
+    using Page = Hidden<Agreements...>::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+// `Among` and `Amidst` are left out for brevity,
+// so this `Indexer` always settles on `Amid`, as it does on GCC.
+// See the source code for the complete selection.
+template<size_t Lookups, typename...Elements>
+struct Indexer
+{
+    using type = Amid<Elements...>;
+};
+
+template<typename...Elements>
+struct Index
+{
+    template<size_t Lookups>
+    using Expect = Indexer<Lookups, Elements...>::type;
+
+    template<size_t Lookups, auto...Agreements>
+    using Foresee = Indexer<Lookups, Elements...>::type
+    ::template Page<Agreements...>;
+
+    template<auto...Agreements>
+    using Page = Foresee<1, Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** SupposedResult ****/
+using SupposedResult = int*;
+
+/**** Result ****/
+using Result = Index<int, int*, int**>::Page<1>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
+
+/**** Indexer ****/
+using Indexed = Index<int, int*, int**>::Expect<100>;
+
+/**** Test ****/
+static_assert(std::same_as<Indexed::Page<0>, int>);
+static_assert(std::same_as<Indexed::Page<2>, int**>);
+
+/**** Test ****/
+static_assert(std::same_as<Index<int, int*, int**>::Foresee<100, 1>, int*>);
@@ -0,0 +1,137 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <tuple>
+
+/**** Shuttle ****/
+template<auto...Variables>
+struct Shuttle
+{
+    template<template<auto...> class Sequence>
+    struct Detail { using type = Sequence<Variables...>; };
+
+    template<template<auto...> class...Sequences>
+    using Rail = Detail<Sequences...>::type;
+};
+
+/**** sift ****/
+template<bool...Flags>
+constexpr auto sift
+{
+    []()
+    {
+        std::array<bool, sizeof...(Flags)> flags {Flags...};
+        std::array<size_t, (0 + ... + Flags)> indices {};
+        size_t counter {0};
+
+        for (size_t i {0}; i < sizeof...(Flags); i++)
+        {
+            if (flags[i])
+            { indices[counter++] = i; }
+        }
+
+        return indices;
+    }()
+};
+
+/**** Lineup ****/
+template<typename...Elements>
+struct Lineup
+{
+    template<size_t I>
+    using UniPage = std::tuple_element_t<I, std::tuple<Elements...>>;
+};
+
+/**** Gather ****/
+template<typename...Elements>
+struct Gather
+{
+    using Map = Lineup<Elements...>;
+
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Elements)) && ...)
+    struct ProtoPage
+    {
+        template<template<typename...> class Operation>
+        struct Detail
+        {
+            using type = Operation<typename Map::template UniPage<Indices>...>;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = Detail<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct KindredFindAll
+{
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    {
+        template<typename Element>
+        struct Detail
+        { static constexpr bool value {(...&&static_cast<bool>(Predicates<Element>::value))}; };
+
+        // Every predicate is evaluated once per element.
+        static constexpr auto value
+        {sift<Detail<Elements>::value...>};
+
+        template<typename>
+        struct Harvest {};
+
+        template<size_t...I>
+        struct Harvest<std::index_sequence<I...>>
+        { using type = Shuttle<value[I]...>; };
+
+        using type = Harvest<std::make_index_sequence<value.size()>>::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+
+    template<template<typename...> class...Agreements>
+    static constexpr auto Road_v
+    {ProtoRoad<Agreements...>::value};
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** IsPointer ****/
+template<typename Element>
+struct IsPointer
+{ static constexpr bool value {std::is_pointer_v<Element>}; };
+
+/**** Operation ****/
+template<typename...>
+struct Operation;
+
+/**** Metafunction ****/
+using Indices = KindredFindAll<int, int*, int, int const*>
+::Road<IsPointer>;
+
+/**** Tests ****/
+static_assert(std::same_as<Indices, Shuttle<size_t{1}, size_t{3}>>);
+static_assert
+(
+    std::same_as
+    <
+        Indices::Rail<Gather<int, int*, int, int const*>::Page>::Road<Operation>,
+        Operation<int*, int const*>
+    >
+);
@@ -0,0 +1,123 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <concepts>
+#include <type_traits>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Ledger ****/
+// Left-fold a list and record the accumulator after every element.
+// `Detail<Capsule<States...>, Accumulator, Elements...>`
+// appends the states of the remaining elements to `States...`.
+// Eight elements are consumed per step so that the recursion is eight times shallower.
+template<template<typename...> class Operation>
+struct Ledger
+{
+    template<typename, typename, typename...>
+    struct Detail {};
+
+    template<typename...States, typename Accumulator>
+    struct Detail<Capsule<States...>, Accumulator>
+    { using type = Capsule<States...>; };
+
+    template<typename...States, typename Accumulator, typename E0, typename...Rest>
+    struct Detail<Capsule<States...>, Accumulator, E0, Rest...>
+    {
+        using S0 = Operation<Accumulator, E0>;
+
+        using type = Detail<Capsule<States..., S0>, S0, Rest...>::type;
+    };
+
+    template
+    <
+        typename...States,
+        typename Accumulator,
+        typename E0, typename E1, typename E2, typename E3,
+        typename E4, typename E5, typename E6, typename E7,
+        typename...Rest
+    >
+    struct Detail
+    <
+        Capsule<States...>,
+        Accumulator,
+        E0, E1, E2, E3, E4, E5, E6, E7,
+        Rest...
+    >
+    {
+        using S0 = Operation<Accumulator, E0>;
+        using S1 = Operation<S0, E1>;
+        using S2 = Operation<S1, E2>;
+        using S3 = Operation<S2, E3>;
+        using S4 = Operation<S3, E4>;
+        using S5 = Operation<S4, E5>;
+        using S6 = Operation<S5, E6>;
+        using S7 = Operation<S6, E7>;
+
+        using type = Detail
+        <Capsule<States..., S0, S1, S2, S3, S4, S5, S6, S7>, S7, Rest...>::type;
+    };
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct KindredFoldLeftAll
+{
+    template<typename Initiator>
+    struct ProtoMold
+    {
+        template<template<typename...> class Operation>
+        struct ProtoRoad
+        {
+            using type = Ledger<Operation>
+            ::template Detail<Capsule<>, Initiator, Elements...>::type;
+        };
+
+        template<template<typename...> class...Agreements>
+        using Road = ProtoRoad<Agreements...>::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Append ****/
+template<typename, typename>
+struct AppendHelper {};
+
+template<typename...Elements, typename Element>
+struct AppendHelper<Capsule<Elements...>, Element>
+{ using type = Capsule<Elements..., Element>; };
+
+template<typename...Args>
+using Append = AppendHelper<Args...>::type;
+
+/**** Metafunction ****/
+template<template<typename...> class...Args>
+using Metafunction = KindredFoldLeftAll<int, int*, int**>
+::Mold<Capsule<>>
+::Road<Args...>;
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule
+<
+    Capsule<int>,
+    Capsule<int, int*>,
+    Capsule<int, int*, int**>
+>;
+
+/**** Result ****/
+using Result = Metafunction<Append>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
\ No newline at end of file
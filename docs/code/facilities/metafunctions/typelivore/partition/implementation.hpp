@@ -0,0 +1,101 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<typename...Elements>
+struct Paste<Capsule<Elements...>>
+{ using type = Capsule<Elements...>; };
+
+template<typename...LeftElements, typename...RightElements, typename...Others>
+struct Paste<Capsule<LeftElements...>, Capsule<RightElements...>, Others...>
+{ using type = Paste<Capsule<LeftElements..., RightElements...>, Others...>::type; };
+
+/**** Distribute ****/
+template<typename, auto Buckets, size_t Count>
+struct Distribute {};
+
+template<typename...Elements, auto Buckets, size_t Count>
+struct Distribute<Capsule<Elements...>, Buckets, Count>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        template<size_t B>
+        using Bucket = Paste
+        <
+            Capsule<>,
+            std::conditional_t<Buckets[I] == B, Capsule<Elements>, Capsule<>>...
+        >::type;
+
+        template<typename>
+        struct Hidden {};
+
+        template<size_t...B>
+        struct Hidden<std::index_sequence<B...>>
+        { using type = Capsule<Bucket<B>...>; };
+
+        using type = Hidden<std::make_index_sequence<Count>>::type;
+    };
+
+    using type = Detail<std::index_sequence_for<Elements...>>::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct Partition
+{
+    template<template<typename...> class...Predicates>
+    struct ProtoRoad
+    {
+        template<typename Element>
+        struct Detail
+        { static constexpr bool value {(...&&static_cast<bool>(Predicates<Element>::value))}; };
+
+        // The elements satisfying all predicates go to the first bucket.
+        static constexpr std::array<size_t, sizeof...(Elements)> buckets
+        {(Detail<Elements>::value ? 0 : 1)...};
+
+        using type = Distribute<Capsule<Elements...>, buckets, 2>::type;
+    };
+
+    template<template<typename...> class...Agreements>
+    using Road = ProtoRoad<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** IsPointer ****/
+template<typename Element>
+struct IsPointer
+{ static constexpr bool value {std::is_pointer_v<Element>}; };
+
+/**** Metafunction ****/
+using Metafunction = Partition<int, int*, char, double*>::Road<IsPointer>;
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule<Capsule<int*, double*>, Capsule<int, char>>;
+
+/**** Test ****/
+static_assert(std::same_as<Metafunction, SupposedResult>);
@@ -0,0 +1,132 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy { using type = Element; };
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{ 
+    static constexpr auto idyl(Key) -> Treasure;
+};
+
+/**** Lineup ****/
+template<typename>
+struct Lineup {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Lineup<Container<Elements...>>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Tyy<Elements>, std::integral_constant<size_t, I>>...
+    { using Label<Tyy<Elements>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    struct Hidden
+    {
+        using type = decltype
+        (
+            Detail<std::index_sequence_for<Elements...>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::type;
+    };
+
+    template<size_t I>
+    using UniPage = Hidden<I>::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct Scatter
+{
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Elements)) && ...)
+    struct ProtoPage
+    {
+        // `slots[I]` is one past the position of the replacement for `Elements[I]`,
+        // or zero if `Elements[I]` is kept.
+        // A later index overwrites an earlier one.
+        static constexpr auto slots
+        {
+            []()
+            {
+                std::array<size_t, sizeof...(Elements)> slots {};
+                size_t slot {};
+                ((slots[Indices] = ++slot), ...);
+                return slots;
+            }()
+        };
+
+        template<typename...Replacements>
+        requires (sizeof...(Replacements) == sizeof...(Indices))
+        struct ProtoMold
+        {
+            template<size_t Slot, typename Element>
+            struct Pick
+            {
+                using type = Lineup<Capsule<Replacements...>>
+                ::template UniPage<Slot - 1>;
+            };
+
+            template<typename Element>
+            struct Pick<0, Element>
+            {
+                using type = Element;
+            };
+
+            template<template<typename...> class Operation, typename>
+            struct Detail {};
+
+            template<template<typename...> class Operation, size_t...I>
+            struct Detail<Operation, std::index_sequence<I...>>
+            {
+                using type = Operation<typename Pick<slots[I], Elements>::type...>;
+            };
+
+            template<template<typename...> class...Agreements>
+            using Road = Detail<Agreements..., std::index_sequence_for<Elements...>>::type;
+        };
+
+        template<typename...Agreements>
+        using Mold = ProtoMold<Agreements...>;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule<char*, int*, int**, char>;
+
+/**** Result ****/
+using Result = Scatter<int, int*, int**, void>
+::Page<3, 0>
+::Mold<char, char*>
+::Road<Capsule>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
@@ -0,0 +1,138 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy
+{ using type = Element; };
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{
+    static constexpr auto idyl(Key) -> Treasure;
+    static constexpr auto lark(Treasure) -> Key;
+};
+
+/**** Lineup ****/
+template<typename>
+struct Lineup {};
+
+template<template<typename...> class Container, typename...Elements>
+struct Lineup<Container<Elements...>>
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Tyy<Elements>, std::integral_constant<size_t, I>>...
+    { using Label<Tyy<Elements>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    struct Hidden
+    {
+        using type = decltype
+        (
+            Detail<std::index_sequence_for<Elements...>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::type;
+    };
+
+    template<size_t I>
+    using UniPage = Hidden<I>::type;
+};
+
+/**** sift ****/
+template<bool...Flags>
+constexpr auto sift
+{
+    []()
+    {
+        std::array<bool, sizeof...(Flags)> flags {Flags...};
+        std::array<size_t, (0 + ... + Flags)> indices {};
+        size_t counter {0};
+
+        for (size_t i {0}; i < sizeof...(Flags); i++)
+        {
+            if (flags[i])
+            { indices[counter++] = i; }
+        }
+
+        return indices;
+    }()
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Elements>
+struct SymmetricDifference
+{
+    struct Inspector
+    : public Tyy<Elements>... {};
+
+    template<typename...Others>
+    struct ProtoMold
+    {
+        struct Examiner
+        : public Tyy<Others>... {};
+
+        // Indices of the elements absent from the arguments.
+        static constexpr auto front
+        {sift<not std::is_base_of_v<Tyy<Elements>, Examiner>...>};
+
+        // Indices of the arguments absent from `Elements`.
+        static constexpr auto back
+        {sift<not std::is_base_of_v<Tyy<Others>, Inspector>...>};
+
+        template<typename, typename>
+        struct Detail {};
+
+        template<size_t...I, size_t...J>
+        struct Detail<std::index_sequence<I...>, std::index_sequence<J...>>
+        {
+            using type = Capsule
+            <
+                typename Lineup<Capsule<Elements...>>
+                ::template UniPage<front[I]>...,
+                typename Lineup<Capsule<Others...>>
+                ::template UniPage<back[J]>...
+            >;
+        };
+
+        using type = Detail
+        <
+            std::make_index_sequence<front.size()>,
+            std::make_index_sequence<back.size()>
+        >::type;
+    };
+
+    template<typename...Agreements>
+    using Mold = ProtoMold<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule<int, int**>;
+
+/**** Result ****/
+using Result = SymmetricDifference<int, int*, void>::Mold<void, int**, int*>;
+
+/**** Test ****/
+static_assert(std::same_as<SupposedResult, Result>);
@@ -0,0 +1,321 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label {};
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy
+{ using type = Element; };
+
+/**** Fingerprint ****/
+template<typename Element>
+consteval auto signify() -> std::string_view
+{ return __PRETTY_FUNCTION__; }
+
+consteval auto digest(std::string_view signature) -> uint64_t
+{
+    uint64_t hash {14695981039346656037ULL};
+
+    for (char letter : signature)
+    {
+        hash ^= static_cast<unsigned char>(letter);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+template<typename Element>
+struct Fingerprint
+{ static constexpr uint64_t value {digest(signify<Element>())}; };
+
+/**** Dependency ****/
+template<typename>
+struct Dependency {};
+
+template<typename Subsystem, typename...Dependencies>
+struct Dependency<Label<Subsystem, Capsule<Dependencies...>>>
+{
+    using type = Subsystem;
+
+    static constexpr uint64_t key {Fingerprint<Subsystem>::value};
+
+    static constexpr size_t size {sizeof...(Dependencies)};
+
+    static constexpr std::array<uint64_t, sizeof...(Dependencies)> keys
+    {Fingerprint<Dependencies>::value...};
+
+    template<typename Roster>
+    static constexpr bool listed {(...&&std::is_base_of_v<Tyy<Dependencies>, Roster>)};
+};
+
+/**** Roster ****/
+template<typename...Subsystems>
+struct Roster
+: public Tyy<Subsystems>... {};
+
+/**** Schedule ****/
+template<size_t Length>
+struct Schedule
+{
+    std::array<size_t, Length> order {};
+    size_t size {0};
+};
+
+// Kahn's algorithm.
+template<size_t Length, size_t Edges>
+constexpr auto schedule
+(
+    std::array<size_t, Length + 1> const & starts,
+    std::array<size_t, Edges> const & targets
+)
+-> Schedule<Length>
+{
+    std::array<size_t, Length + 1> offsets {};
+    std::array<size_t, Edges> dependents {};
+    std::array<size_t, Length> pending {};
+
+    for (size_t i {0}; i < Length; i++)
+    {
+        for (size_t k {starts[i]}; k < starts[i + 1]; k++)
+        {
+            if (targets[k] < Length)
+            {
+                offsets[targets[k] + 1]++;
+                pending[i]++;
+            }
+        }
+    }
+
+    for (size_t i {0}; i < Length; i++)
+    { offsets[i + 1] += offsets[i]; }
+
+    std::array<size_t, Length + 1> cursors {offsets};
+
+    for (size_t i {0}; i < Length; i++)
+    {
+        for (size_t k {starts[i]}; k < starts[i + 1]; k++)
+        {
+            if (targets[k] < Length)
+            { dependents[cursors[targets[k]]++] = i; }
+        }
+    }
+
+    Schedule<Length> result {};
+
+    for (size_t i {0}; i < Length; i++)
+    {
+        if (pending[i] == 0)
+        { result.order[result.size++] = i; }
+    }
+
+    for (size_t front {0}; front < result.size; front++)
+    {
+        size_t node {result.order[front]};
+
+        for (size_t k {offsets[node]}; k < offsets[node + 1]; k++)
+        {
+            if (--pending[dependents[k]] == 0)
+            { result.order[result.size++] = dependents[k]; }
+        }
+    }
+
+    return result;
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<typename...Nodes>
+struct TypicalTopologicalSort
+{
+    static constexpr size_t length {sizeof...(Nodes)};
+
+    static constexpr size_t capacity {std::bit_ceil(2 * length + 1)};
+
+    struct Table
+    {
+        std::array<uint64_t, capacity> keys {};
+        std::array<size_t, capacity> indices {};
+
+        constexpr auto find(uint64_t key) const -> size_t
+        {
+            size_t position {(key ^ (key >> 32)) & (capacity - 1)};
+
+            while (indices[position] != 0 && keys[position] != key)
+            { position = (position + 1) & (capacity - 1); }
+
+            return position;
+        }
+    };
+
+    static constexpr Table table
+    {
+        []()
+        {
+            std::array<uint64_t, length> keys {Dependency<Nodes>::key...};
+            Table result {};
+
+            for (size_t i {0}; i < length; i++)
+            {
+                size_t position {result.find(keys[i])};
+
+                if (result.indices[position] == 0)
+                {
+                    result.keys[position] = keys[i];
+                    result.indices[position] = i + 1;
+                }
+            }
+
+            return result;
+        }()
+    };
+
+    static constexpr bool unique
+    {
+        []()
+        {
+            std::array<uint64_t, length> keys {Dependency<Nodes>::key...};
+
+            for (size_t i {0}; i < length; i++)
+            {
+                if (table.indices[table.find(keys[i])] != i + 1)
+                { return false; }
+            }
+
+            return true;
+        }()
+    };
+
+    using RosterOfSubsystems = std::conditional_t
+    <
+        unique,
+        Roster<typename Dependency<Nodes>::type...>,
+        Capsule<>
+    >;
+
+    static constexpr bool complete
+    {
+        []()
+        {
+            std::array<bool, length> listed
+            {Dependency<Nodes>::template listed<RosterOfSubsystems>...};
+
+            for (bool item : listed)
+            {
+                if (not item)
+                { return false; }
+            }
+
+            return true;
+        }()
+    };
+
+    static constexpr auto starts
+    {
+        []()
+        {
+            std::array<size_t, length> sizes {Dependency<Nodes>::size...};
+            std::array<size_t, length + 1> result {};
+
+            for (size_t i {0}; i < length; i++)
+            { result[i + 1] = result[i] + sizes[i]; }
+
+            return result;
+        }()
+    };
+
+    static constexpr size_t edges {starts[length]};
+
+    static constexpr auto targets
+    {
+        []()
+        {
+            std::array<uint64_t const *, length> lists {Dependency<Nodes>::keys.data()...};
+            std::array<size_t, edges> result {};
+
+            for (size_t i {0}; i < length; i++)
+            {
+                for (size_t k {starts[i]}; k < starts[i + 1]; k++)
+                { result[k] = table.indices[table.find(lists[i][k - starts[i]])] - 1; }
+            }
+
+            return result;
+        }()
+    };
+
+    static constexpr auto order {schedule<length, edges>(starts, targets)};
+
+    static_assert(unique, "every subsystem must be listed exactly once.");
+    static_assert(not unique || complete, "every dependency must be listed as a subsystem.");
+    static_assert
+    (
+        not unique || not complete || order.size == length,
+        "the dependency graph contains a cycle."
+    );
+
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    {
+        struct Directory
+        : public Label<Tyy<typename Dependency<Nodes>::type>, std::integral_constant<size_t, I>>... {};
+
+        template<size_t Index, typename Subsystem>
+        static consteval auto pick(Label<Tyy<Subsystem>, std::integral_constant<size_t, Index>> const *)
+        -> Tyy<Subsystem>;
+
+        using type = Capsule
+        <
+            typename decltype(pick<order.order[I]>(static_cast<Directory const *>(nullptr)))::type...
+        >;
+    };
+
+    using type = Detail<std::make_index_sequence<length>>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+struct Config;
+struct Log;
+struct Network;
+struct Metrics;
+struct Application;
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule<Config, Log, Network, Metrics, Application>;
+
+/**** Result ****/
+using Result = TypicalTopologicalSort
+<
+    Label<Application, Capsule<Network, Metrics>>,
+    Label<Network, Capsule<Config, Log>>,
+    Label<Metrics, Capsule<Log>>,
+    Label<Log, Capsule<Config>>,
+    Label<Config, Capsule<>>
+>::type;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
@@ -0,0 +1,90 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** Unfold ****/
+template<auto const&, typename>
+struct Unfold {};
+
+// The variables are read through a reference,
+// so the expansion is instantiated without the pack of the caller.
+template<auto const& Table, size_t...I>
+struct Unfold<Table, std::index_sequence<I...>>
+{ using type = Shuttle<Table[I]...>; };
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Sizes>
+struct AlignedScan
+{
+    template<auto...Alignments>
+    struct ProtoPage
+    {
+        static_assert
+        (
+            sizeof...(Alignments) == sizeof...(Sizes),
+            "Conceptrodon::Varybivore::AlignedScan: every size requires an alignment."
+        );
+
+        static_assert
+        (
+            ((0 < Alignments) && ...),
+            "Conceptrodon::Varybivore::AlignedScan: alignments must be positive."
+        );
+
+        // Each offset is the end of the previous element,
+        // rounded up to a multiple of the alignment of the current one.
+        static constexpr auto offsets = []()
+        {
+            std::array<size_t, sizeof...(Sizes)> sizes {static_cast<size_t>(Sizes)...};
+            std::array<size_t, sizeof...(Sizes)> alignments
+            {static_cast<size_t>(Alignments)...};
+            std::array<size_t, sizeof...(Sizes)> offsets {};
+            size_t offset {0};
+
+            for (size_t i {0}; i < sizes.size(); i++)
+            {
+                offset = (offset + alignments[i] - 1) / alignments[i] * alignments[i];
+                offsets[i] = offset;
+                offset += sizes[i];
+            }
+
+            return offsets;
+        }();
+
+        using type = Unfold
+        <offsets, std::make_index_sequence<sizeof...(Sizes)>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<auto...Args>
+using Metafunction = AlignedScan<1, 8, 2, 4>::Page<Args...>;
+
+/**** SupposedResult ****/
+using SupposedResult = Shuttle<size_t{0}, size_t{8}, size_t{16}, size_t{20}>;
+
+/**** Result ****/
+using Result = Metafunction<1, 8, 2, 4>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
\ No newline at end of file
@@ -0,0 +1,103 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+/**** conformable ****/
+template<typename Type, typename Variable>
+constexpr bool conformable(Variable variable)
+{
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Variable>)
+    {
+        return static_cast<Variable>(static_cast<Type>(variable)) == variable
+        && (static_cast<Type>(variable) < Type{}) == (variable < Variable{});
+    }
+
+    else
+    { return true; }
+}
+
+/**** Ascent ****/
+template<auto...Variables>
+struct Ascent
+{
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    static constexpr std::array<value_type, sizeof...(Variables)> value
+    {static_cast<value_type>(Variables)...};
+
+    static_assert
+    (
+        std::ranges::is_sorted(value),
+        "Conceptrodon::Varybivore: variables must be sorted in ascending order."
+    );
+};
+
+/**** BinarySearchProbe ****/
+template<auto const& Table>
+struct BinarySearchProbe
+{
+    template<auto Inspecting>
+    struct ProtoPage
+    {
+        using value_type = std::remove_cvref_t<decltype(Table)>::value_type;
+
+        static_assert
+        (
+            conformable<value_type>(Inspecting),
+            "Conceptrodon::Varybivore: the target must keep its value in the type of the variables."
+        );
+
+        static constexpr bool value
+        {std::ranges::binary_search(Table, static_cast<value_type>(Inspecting))};
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Inspecting>
+    static constexpr bool Page_v {ProtoPage<Inspecting>::value};
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct BinarySearch
+: public BinarySearchProbe<Ascent<Variables...>::value> {};
+
+template<>
+struct BinarySearch<>
+{
+    template<auto Inspecting>
+    struct ProtoPage
+    { static constexpr bool value {false}; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Inspecting>
+    static constexpr bool Page_v {false};
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<auto...Args>
+using Metafunction = BinarySearch<1, 3, 3, 5>::Page<Args...>;
+
+/**** Tests ****/
+static_assert(Metafunction<5>::value);
+static_assert(! Metafunction<4>::value);
\ No newline at end of file
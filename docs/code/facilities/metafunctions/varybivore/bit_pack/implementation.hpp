@@ -0,0 +1,146 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**** Bits ****/
+// A structural bitset of `Length` bits stored in 64-bit words.
+// Bit `i` lives in `words[i / 64]` at position `i % 64`.
+// Bits past `Length` are always zero.
+template<size_t Length>
+struct Bits
+{
+    static constexpr size_t length {Length};
+    static constexpr size_t width {64};
+    static constexpr size_t size {(Length + width - 1) / width};
+
+    std::array<uint64_t, size> words {};
+
+    // Mask of the valid bits of the word at `index`.
+    static constexpr auto mask(size_t index) -> uint64_t
+    {
+        if (index + 1 < size || Length % width == 0)
+        { return ~uint64_t {0}; }
+        return (uint64_t {1} << (Length % width)) - 1;
+    }
+
+    constexpr auto test(size_t index) const -> bool
+    { return (words[index / width] >> (index % width)) & 1; }
+
+    constexpr auto operator&(Bits const& other) const -> Bits
+    {
+        Bits result {};
+        for (size_t i {0}; i < size; i++)
+        { result.words[i] = words[i] & other.words[i]; }
+        return result;
+    }
+
+    constexpr auto operator|(Bits const& other) const -> Bits
+    {
+        Bits result {};
+        for (size_t i {0}; i < size; i++)
+        { result.words[i] = words[i] | other.words[i]; }
+        return result;
+    }
+
+    constexpr auto operator~() const -> Bits
+    {
+        Bits result {};
+        for (size_t i {0}; i < size; i++)
+        { result.words[i] = ~words[i] & mask(i); }
+        return result;
+    }
+
+    constexpr auto count() const -> size_t
+    {
+        size_t counter {0};
+        for (size_t i {0}; i < size; i++)
+        { counter += std::popcount(words[i]); }
+        return counter;
+    }
+
+    // Index of the first set bit, or -1 if no bit is set.
+    constexpr auto first() const -> std::make_signed_t<size_t>
+    {
+        for (size_t i {0}; i < size; i++)
+        {
+            if (words[i] != 0)
+            { return i * width + std::countr_zero(words[i]); }
+        }
+        return -1;
+    }
+
+    constexpr auto all() const -> bool
+    {
+        for (size_t i {0}; i < size; i++)
+        {
+            if (words[i] != mask(i))
+            { return false; }
+        }
+        return true;
+    }
+
+    constexpr auto any() const -> bool
+    {
+        for (size_t i {0}; i < size; i++)
+        {
+            if (words[i] != 0)
+            { return true; }
+        }
+        return false;
+    }
+
+    constexpr auto operator==(Bits const&) const -> bool = default;
+};
+
+template<bool...Phenomena>
+consteval auto pack() -> Bits<sizeof...(Phenomena)>
+{
+    std::array<bool, sizeof...(Phenomena)> phenomena {Phenomena...};
+    Bits<sizeof...(Phenomena)> result {};
+
+    for (size_t i {0}; i < sizeof...(Phenomena); i++)
+    {
+        if (phenomena[i])
+        { result.words[i / 64] |= uint64_t {1} << (i % 64); }
+    }
+
+    return result;
+}
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Phenomena>
+struct BitPack
+{
+    static constexpr Bits<sizeof...(Phenomena)> value
+    {pack<static_cast<bool>(Phenomena)...>()};
+};
+
+template<auto...Phenomena>
+constexpr Bits<sizeof...(Phenomena)> BitPack_v
+{pack<static_cast<bool>(Phenomena)...>()};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Packed ****/
+constexpr auto packed = BitPack<true, false, 1, 0>::value;
+
+/**** Tests ****/
+static_assert(packed.test(0));
+static_assert(packed.count() == 2);
+static_assert(packed.first() == 0);
+static_assert(packed.any());
+static_assert(! packed.all());
+static_assert((packed & BitPack_v<0, 0, 1, 1>) == BitPack_v<0, 0, 1, 0>);
+static_assert((packed | BitPack_v<0, 0, 1, 1>) == BitPack_v<1, 0, 1, 1>);
+static_assert(~packed == BitPack_v<0, 1, 0, 1>);
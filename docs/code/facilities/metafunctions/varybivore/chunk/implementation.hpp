@@ -0,0 +1,234 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstddef>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** Tyy ****/
+template<typename Element>
+struct Tyy
+{ using type = Element; };
+
+/**** Vay ****/
+template<auto Variable>
+struct Vay
+{ static constexpr auto value {Variable}; };
+
+/**** Prefix ****/
+template<typename, auto>
+concept Prefix = true;
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<typename...Elements>
+struct Paste<Capsule<Elements...>>
+{ using type = Capsule<Elements...>; };
+
+template<typename...LeftElements, typename...RightElements, typename...Others>
+struct Paste<Capsule<LeftElements...>, Capsule<RightElements...>, Others...>
+{ using type = Paste<Capsule<LeftElements..., RightElements...>, Others...>::type; };
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+/**** Fore ****/
+template<typename>
+struct Fore {};
+
+template<size_t...I>
+struct Fore<std::index_sequence<I...>>
+{
+    template<template<typename...> class Operation>
+    static consteval auto idyl
+    (
+        Prefix<I> auto...targets,
+        ...
+    )
+    -> Operation<typename decltype(targets)::type...>;
+};
+
+/**** Shear ****/
+template<typename>
+struct Shear {};
+
+template<size_t...I>
+struct Shear<std::index_sequence<I...>>
+{
+    template
+    <
+        template<typename...> class Operation,
+        typename...Targets
+    >
+    static consteval auto idyl
+    (
+        Prefix<I> auto...,
+        Targets...
+    )
+    -> Operation<typename Targets::type...>;
+};
+
+/**** Tiling ****/
+// Group `G` starts from item `G * Stride` and holds at most `Size` items.
+// A shorter trailing group is kept only if the tiling is `Ragged`.
+template<size_t Length, size_t Size, size_t Stride, bool Ragged>
+struct Tiling
+{
+    static constexpr size_t count
+    {
+        Ragged ? (Length + Stride - 1) / Stride
+        : Length < Size ? 0 : (Length - Size) / Stride + 1
+    };
+
+    static constexpr auto start(size_t group) -> size_t
+    { return group * Stride; }
+
+    static constexpr auto width(size_t group) -> size_t
+    { return Length - start(group) < Size ? Length - start(group) : Size; }
+
+    static constexpr auto end(size_t group) -> size_t
+    { return start(group) + width(group); }
+};
+
+/**** Unveil ****/
+template<typename...Treasures>
+using Unveil = Shuttle<Treasures::value...>;
+
+/**** Tessellate ****/
+// Groups from `Low` to `High` are built from the treasures
+// that begin at the first item of group `Low`.
+// The range is halved at each level,
+// so every treasure is moved a logarithmic number of times
+// instead of once per group.
+template
+<
+    typename Tiles,
+    template<typename...> class Assemble,
+    size_t Low = 0,
+    size_t High = Tiles::count
+>
+struct Tessellate
+{
+    static constexpr size_t middle {(Low + High) / 2};
+
+    template<typename>
+    struct Detail {};
+
+    template<typename...Treasures>
+    struct Detail<Capsule<Treasures...>>
+    {
+        using type = Paste
+        <
+            typename Tessellate<Tiles, Assemble, Low, middle>::template Detail
+            <
+                decltype
+                (
+                    Fore<std::make_index_sequence<Tiles::end(middle - 1) - Tiles::start(Low)>>
+                    ::template idyl<Capsule>(Tyy<Treasures>{}...)
+                )
+            >::type,
+            typename Tessellate<Tiles, Assemble, middle, High>::template Detail
+            <
+                decltype
+                (
+                    Shear<std::make_index_sequence<Tiles::start(middle) - Tiles::start(Low)>>
+                    ::template idyl<Capsule>(Tyy<Treasures>{}...)
+                )
+            >::type
+        >::type;
+    };
+};
+
+template<typename Tiles, template<typename...> class Assemble, size_t Low, size_t High>
+requires (Low == High)
+struct Tessellate<Tiles, Assemble, Low, High>
+{
+    // Without groups, the result is empty.
+    template<typename>
+    struct Detail
+    { using type = Capsule<>; };
+};
+
+template<typename Tiles, template<typename...> class Assemble, size_t Low, size_t High>
+requires (Low + 1 == High)
+struct Tessellate<Tiles, Assemble, Low, High>
+{
+    template<typename>
+    struct Detail {};
+
+    template<typename...Treasures>
+    struct Detail<Capsule<Treasures...>>
+    {
+        using type = Capsule
+        <
+            decltype
+            (
+                Fore<std::make_index_sequence<Tiles::width(Low)>>
+                ::template idyl<Assemble>(Tyy<Treasures>{}...)
+            )
+        >;
+    };
+};
+
+/**** Chunk ****/
+template<auto...Variables>
+struct Chunk
+{
+    template<auto...>
+    struct ProtoPage {};
+
+    template<auto Size>
+    struct ProtoPage<Size>
+    {
+        static_assert
+        (
+            0 < Size,
+            "Conceptrodon::Varybivore::Chunk: size must be positive."
+        );
+
+        using type = Tessellate
+        <
+            Tiling<sizeof...(Variables), Size, Size, true>,
+            Unveil
+        >
+        ::template Detail<Capsule<Vay<Variables>...>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** Metafunction ****/
+template<auto...Args>
+using Metafunction = Chunk<0, 1, 2, 3, 4>::Page<Args...>;
+
+/**** SupposedResult ****/
+using SupposedResult = Capsule
+<
+    Shuttle<0, 1>,
+    Shuttle<2, 3>,
+    Shuttle<4>
+>;
+
+/**** Result ****/
+using Result = Metafunction<2>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
\ No newline at end of file
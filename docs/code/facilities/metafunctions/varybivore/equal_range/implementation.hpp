@@ -0,0 +1,111 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <concepts>
+#include <cstddef>
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** conformable ****/
+template<typename Type, typename Variable>
+constexpr bool conformable(Variable variable)
+{
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Variable>)
+    {
+        return static_cast<Variable>(static_cast<Type>(variable)) == variable
+        && (static_cast<Type>(variable) < Type{}) == (variable < Variable{});
+    }
+
+    else
+    { return true; }
+}
+
+/**** Ascent ****/
+template<auto...Variables>
+struct Ascent
+{
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    static constexpr std::array<value_type, sizeof...(Variables)> value
+    {static_cast<value_type>(Variables)...};
+
+    static_assert
+    (
+        std::ranges::is_sorted(value),
+        "Conceptrodon::Varybivore: variables must be sorted in ascending order."
+    );
+};
+
+/**** EqualRangeProbe ****/
+template<auto const& Table>
+struct EqualRangeProbe
+{
+    template<auto Target>
+    struct ProtoPage
+    {
+        using value_type = std::remove_cvref_t<decltype(Table)>::value_type;
+
+        static_assert
+        (
+            conformable<value_type>(Target),
+            "Conceptrodon::Varybivore: the target must keep its value in the type of the variables."
+        );
+
+        static constexpr auto range
+        {std::ranges::equal_range(Table, static_cast<value_type>(Target))};
+
+        // The indices can be handed to `Slice` through `Rail`.
+        using type = Shuttle
+        <
+            static_cast<size_t>(range.begin() - Table.begin()),
+            static_cast<size_t>(range.end() - Table.begin())
+        >;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct EqualRange
+: public EqualRangeProbe<Ascent<Variables...>::value> {};
+
+// Without variables, every range is empty.
+template<>
+struct EqualRange<>
+{
+    template<auto Target>
+    struct ProtoPage
+    { using type = Shuttle<size_t{0}, size_t{0}>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<auto...Args>
+using Metafunction = EqualRange<1, 3, 3, 5>::Page<Args...>;
+
+/**** Tests ****/
+static_assert(std::same_as<Metafunction<3>, Shuttle<size_t{1}, size_t{3}>>);
+static_assert(std::same_as<Metafunction<4>, Shuttle<size_t{3}, size_t{3}>>);
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** conformable ****/
+template<typename Type, typename Variable>
+constexpr bool conformable(Variable variable)
+{
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Variable>)
+    {
+        return static_cast<Variable>(static_cast<Type>(variable)) == variable
+        && (static_cast<Type>(variable) < Type{}) == (variable < Variable{});
+    }
+
+    else
+    { return true; }
+}
+
+/**** Unfold ****/
+template<auto const&, typename>
+struct Unfold {};
+
+// The variables are read through a reference,
+// so the expansion is instantiated without the pack of the caller.
+template<auto const& Table, size_t...I>
+struct Unfold<Table, std::index_sequence<I...>>
+{ using type = Shuttle<Table[I]...>; };
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct ExclusiveScan
+{
+    // The variables are converted to their common type.
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    template<auto Init, auto Operation = std::plus<> {}>
+    struct ProtoPage
+    {
+        // The `I`th total combines `Init` with the first `I` variables.
+        static constexpr auto totals = []()
+        {
+            std::array<value_type, sizeof...(Variables)> variables
+            {static_cast<value_type>(Variables)...};
+            std::array<decltype(Init), sizeof...(Variables)> totals {};
+            auto total {Init};
+
+            for (size_t i {0}; i < variables.size(); i++)
+            {
+                totals[i] = total;
+                total = Operation(total, variables[i]);
+            }
+
+            return totals;
+        }();
+
+        using type = Unfold
+        <totals, std::make_index_sequence<sizeof...(Variables)>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+// Without variables, there is nothing to accumulate.
+template<>
+struct ExclusiveScan<>
+{
+    template<auto Init, auto Operation = std::plus<> {}>
+    struct ProtoPage
+    { using type = Shuttle<>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<auto...Args>
+using Metafunction = ExclusiveScan<1, 2, 3, 4>::Page<Args...>;
+
+/**** Tests ****/
+static_assert(std::same_as<Metafunction<0>, Shuttle<0, 1, 3, 6>>);
+static_assert(std::same_as<Metafunction<1, std::multiplies<> {}>, Shuttle<1, 1, 2, 6>>);
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <cstddef>
+#include <utility>
+
+/**** Vay ****/
+template<auto Variable>
+struct Vay { static constexpr auto value {Variable}; };
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{ 
+    static constexpr auto idyl(Key) -> Treasure;
+};
+
+/**** Amid ****/
+template<auto...Variables>
+struct Amid
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Vay<Variables>, std::integral_constant<size_t, I>>...
+    { using Label<Vay<Variables>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    static constexpr auto Page_v
+    {
+        decltype
+        (
+            Detail<std::make_index_sequence<sizeof...(Variables)>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::value
+    };
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct Gather
+{
+    // Every lookup resolves against the same overload set.
+    using Map = Amid<Variables...>;
+
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Variables)) && ...)
+    struct ProtoPage
+    {
+        template<template<auto...> class Operation>
+        struct Detail
+        {
+            using type = Operation<Map::template Page_v<Indices>...>;
+        };
+
+        template<template<auto...> class...Agreements>
+        using Rail = Detail<Agreements...>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** Operation ****/
+template<auto...>
+struct Operation;
+
+/**** SupposedResult ****/
+using SupposedResult = Operation<'c', 0, 0>;
+
+/**** Result ****/
+using Result = Gather<0, 1, 2, 'c'>
+::Page<3, 0, 0>
+::Rail<Operation>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
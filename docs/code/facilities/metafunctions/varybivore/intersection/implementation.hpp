@@ -0,0 +1,132 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** Vay ****/
+template<auto Variable>
+struct Vay
+{ static constexpr auto value {Variable}; };
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{
+    static constexpr auto idyl(Key) -> Treasure;
+    static constexpr auto lark(Treasure) -> Key;
+};
+
+/**** Amid ****/
+template<auto...Variables>
+struct Amid
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Vay<Variables>, std::integral_constant<size_t, I>>...
+    { using Label<Vay<Variables>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    struct ProtoPage
+    {
+        static constexpr auto value 
+        {
+            decltype
+            (
+                Detail<std::make_index_sequence<sizeof...(Variables)>>
+                ::idyl(std::integral_constant<size_t, I>{})
+            )::value
+        };
+    };
+
+    template<size_t I>
+    static constexpr auto Page_v
+    {
+        decltype
+        (
+            Detail<std::make_index_sequence<sizeof...(Variables)>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::value
+    };
+};
+
+/**** sift ****/
+template<bool...Flags>
+constexpr auto sift
+{
+    []()
+    {
+        std::array<bool, sizeof...(Flags)> flags {Flags...};
+        std::array<size_t, (0 + ... + Flags)> indices {};
+        size_t counter {0};
+
+        for (size_t i {0}; i < sizeof...(Flags); i++)
+        {
+            if (flags[i])
+            { indices[counter++] = i; }
+        }
+
+        return indices;
+    }()
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct Intersection
+{
+    template<auto...Others>
+    struct ProtoPage
+    {
+        struct Inspector
+        : public Vay<Others>... {};
+
+        // Indices of the variables present in the arguments.
+        static constexpr auto kept
+        {sift<std::is_base_of_v<Vay<Variables>, Inspector>...>};
+
+        template<typename>
+        struct Detail {};
+
+        template<size_t...I>
+        struct Detail<std::index_sequence<I...>>
+        {
+            using type = Shuttle
+            <
+                Amid<Variables...>
+                ::template Page_v<kept[I]>...
+            >;
+        };
+
+        using type = Detail<std::make_index_sequence<kept.size()>>::type;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** SupposedResult ****/
+using SupposedResult = Shuttle<2, 3>;
+
+/**** Result ****/
+using Result = Intersection<1, 2, 3>::Page<3, 4, 2>;
+
+/**** Test ****/
+static_assert(std::same_as<SupposedResult, Result>);
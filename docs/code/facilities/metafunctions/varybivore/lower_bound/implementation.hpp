@@ -0,0 +1,105 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <cstddef>
+
+/**** conformable ****/
+template<typename Type, typename Variable>
+constexpr bool conformable(Variable variable)
+{
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Variable>)
+    {
+        return static_cast<Variable>(static_cast<Type>(variable)) == variable
+        && (static_cast<Type>(variable) < Type{}) == (variable < Variable{});
+    }
+
+    else
+    { return true; }
+}
+
+/**** Ascent ****/
+template<auto...Variables>
+struct Ascent
+{
+    using value_type = std::common_type_t<decltype(Variables)...>;
+
+    static_assert
+    (
+        (conformable<value_type>(Variables) && ...),
+        "Conceptrodon::Varybivore: variables must keep their values in their common type."
+    );
+
+    static constexpr std::array<value_type, sizeof...(Variables)> value
+    {static_cast<value_type>(Variables)...};
+
+    static_assert
+    (
+        std::ranges::is_sorted(value),
+        "Conceptrodon::Varybivore: variables must be sorted in ascending order."
+    );
+};
+
+/**** LowerBoundProbe ****/
+template<auto const& Table>
+struct LowerBoundProbe
+{
+    template<auto Target>
+    struct ProtoPage
+    {
+        using value_type = std::remove_cvref_t<decltype(Table)>::value_type;
+
+        static_assert
+        (
+            conformable<value_type>(Target),
+            "Conceptrodon::Varybivore: the target must keep its value in the type of the variables."
+        );
+
+        static constexpr size_t value
+        {static_cast<size_t>(std::ranges::lower_bound(Table, static_cast<value_type>(Target)) - Table.begin())};
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Target>
+    static constexpr size_t Page_v {ProtoPage<Target>::value};
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct LowerBound
+: public LowerBoundProbe<Ascent<Variables...>::value> {};
+
+// Without variables, every target belongs at the front.
+template<>
+struct LowerBound<>
+{
+    template<auto Target>
+    struct ProtoPage
+    { static constexpr size_t value {0}; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+
+    template<auto Target>
+    static constexpr size_t Page_v {0};
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+template<auto...Args>
+using Metafunction = LowerBound<1, 3, 3, 5>::Page<Args...>;
+
+/**** Tests ****/
+static_assert(Metafunction<3>::value == 1);
+static_assert(Metafunction<6>::value == 4);
\ No newline at end of file
@@ -0,0 +1,217 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Lazy ****/
+template<typename Origin, size_t Start, size_t End>
+struct Sliced;
+
+template<typename Origin, size_t Start, size_t End>
+struct Expunged;
+
+template<typename Origin, size_t Amount>
+struct Swiveled;
+
+template<typename Origin>
+struct Reversed;
+
+template<typename Origin, template<auto...> class Device>
+struct Gauged;
+
+template<typename Origin>
+struct Lazy
+{
+    template<size_t Index>
+    requires (Index < Origin::size())
+    struct Among
+    { static constexpr auto value {Origin::template Among_v<Index>}; };
+
+    template<size_t...>
+    struct ProtoSlice {};
+
+    template<size_t Amount>
+    requires (Amount <= Origin::size())
+    struct ProtoSlice<Amount>
+    { using type = Sliced<Origin, Amount, Origin::size()>; };
+
+    template<size_t Start, size_t End>
+    requires (Start <= End && End <= Origin::size())
+    struct ProtoSlice<Start, End>
+    { using type = Sliced<Origin, Start, End>; };
+
+    template<size_t...Agreements>
+    using Slice = ProtoSlice<Agreements...>::type;
+
+    template<size_t...>
+    struct ProtoErase {};
+
+    template<size_t Index>
+    requires (Index < Origin::size())
+    struct ProtoErase<Index>
+    { using type = Expunged<Origin, Index, Index + 1>; };
+
+    template<size_t Start, size_t End>
+    requires (Start <= End && End <= Origin::size())
+    struct ProtoErase<Start, End>
+    { using type = Expunged<Origin, Start, End>; };
+
+    template<size_t...Agreements>
+    using Erase = ProtoErase<Agreements...>::type;
+
+    template<size_t Amount>
+    requires (Amount <= Origin::size())
+    using Rotate = Swiveled<Origin, Amount>;
+
+    using TurnOver = Reversed<Origin>;
+
+    template<template<auto...> class Device>
+    using Gauge = Gauged<Origin, Device>;
+
+    template<typename, template<auto...> class>
+    struct Detail {};
+
+    template<size_t...I, template<auto...> class Operation>
+    struct Detail<std::index_sequence<I...>, Operation>
+    { using type = Operation<Origin::template Among_v<I>...>; };
+
+    template<template<auto...> class Operation>
+    struct ProtoRail
+    { using type = Detail<std::make_index_sequence<Origin::size()>, Operation>::type; };
+
+    template<template<auto...> class...Agreements>
+    using Rail = ProtoRail<Agreements...>::type;
+
+    template<template<auto...> class Operation>
+    using UniRail = ProtoRail<Operation>::type;
+};
+
+template<typename Origin, size_t Start, size_t End>
+struct Sliced: public Lazy<Sliced<Origin, Start, End>>
+{
+    static constexpr size_t size() { return End - Start; }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Origin::template Among_v<Start + Index>};
+};
+
+template<typename Origin, size_t Start, size_t End>
+struct Expunged: public Lazy<Expunged<Origin, Start, End>>
+{
+    static constexpr size_t size() { return Origin::size() - (End - Start); }
+
+    template<size_t Index>
+    static constexpr auto Among_v
+    {Origin::template Among_v<(Index < Start ? Index : Index + (End - Start))>};
+};
+
+template<typename Origin, size_t Amount>
+struct Swiveled: public Lazy<Swiveled<Origin, Amount>>
+{
+    static constexpr size_t size() { return Origin::size(); }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Origin::template Among_v<(Index + Amount) % Origin::size()>};
+};
+
+template<typename Origin>
+struct Reversed: public Lazy<Reversed<Origin>>
+{
+    static constexpr size_t size() { return Origin::size(); }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Origin::template Among_v<Origin::size() - 1 - Index>};
+};
+
+template<typename Origin, template<auto...> class Device>
+struct Gauged: public Lazy<Gauged<Origin, Device>>
+{
+    static constexpr size_t size() { return Origin::size(); }
+
+    template<size_t Index>
+    static constexpr auto Among_v {Device<Origin::template Among_v<Index>>::value};
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto Start, auto Stop, auto Step = 1>
+requires std::integral<std::common_type_t<decltype(Start), decltype(Stop), decltype(Step)>>
+&& (Step != 0)
+struct Range: public Lazy<Range<Start, Stop, Step>>
+{
+    using value_type = std::common_type_t<decltype(Start), decltype(Stop), decltype(Step)>;
+
+    static constexpr value_type start {static_cast<value_type>(Start)};
+    static constexpr value_type step {static_cast<value_type>(Step)};
+
+    static constexpr size_t size()
+    {
+        if constexpr (0 < Step)
+        {
+            if (std::cmp_less(Start, Stop))
+            { return (static_cast<value_type>(Stop) - start + step - 1) / step; }
+        }
+
+        else
+        {
+            if (std::cmp_greater(Start, Stop))
+            {
+                return (start - static_cast<value_type>(Stop) - step - 1)
+                / static_cast<value_type>(-step);
+            }
+        }
+
+        return 0;
+    }
+
+    template<size_t Index>
+    static constexpr value_type Among_v {static_cast<value_type>(start + static_cast<value_type>(Index) * step)};
+
+    template<size_t Index>
+    static constexpr value_type Bound_v {[]()
+    {
+        if constexpr (Index < size())
+        { return Among_v<Index>; }
+
+        else
+        { return static_cast<value_type>(Stop); }
+    }()};
+
+    template<size_t...>
+    struct ProtoSlice {};
+
+    template<size_t Amount>
+    requires (Amount <= size())
+    struct ProtoSlice<Amount>
+    { using type = Range<Bound_v<Amount>, Bound_v<size()>, Step>; };
+
+    template<size_t Begin, size_t End>
+    requires (Begin <= End && End <= size())
+    struct ProtoSlice<Begin, End>
+    { using type = Range<Bound_v<Begin>, Bound_v<End>, Step>; };
+
+    template<size_t...Agreements>
+    using Slice = ProtoSlice<Agreements...>::type;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Operation ****/
+template<auto...>
+struct Operation;
+
+/**** Tests ****/
+static_assert(Range<0, 10000>::size() == 10000);
+static_assert(Range<0, 10000>::Among<9999>::value == 9999);
+static_assert(std::same_as<Range<0, 100, 10>::Slice<2, 5>, Range<20, 50, 10>>);
+static_assert(std::same_as<Range<0, 5>::Erase<1, 3>::Rail<Operation>, Operation<0, 3, 4>>);
+static_assert(std::same_as<Range<0, 5>::Rotate<2>::Rail<Operation>, Operation<2, 3, 4, 0, 1>>);
+static_assert(std::same_as<Range<0, 5>::TurnOver::Rail<Operation>, Operation<4, 3, 2, 1, 0>>);
@@ -0,0 +1,139 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**** Capsule ****/
+template<typename...>
+struct Capsule;
+
+/**** Shuttle ****/
+template<auto...>
+struct Shuttle;
+
+/**** Paste ****/
+template<typename...>
+struct Paste {};
+
+template<auto...Variables>
+struct Paste<Shuttle<Variables...>>
+{ using type = Shuttle<Variables...>; };
+
+template<auto...LeftVariables, auto...RightVariables, typename...Others>
+struct Paste<Shuttle<LeftVariables...>, Shuttle<RightVariables...>, Others...>
+{ using type = Paste<Shuttle<LeftVariables..., RightVariables...>, Others...>::type; };
+
+/**** SolitaryIsSame ****/
+template<auto, auto>
+struct SolitaryIsSame
+{ static constexpr bool value {false}; };
+
+template<auto Variable>
+struct SolitaryIsSame<Variable, Variable>
+{ static constexpr bool value {true}; };
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct RunLengthEncode
+{
+    // Never equal to any variable.
+    struct Sentinel {};
+
+    template<typename, typename>
+    struct Detail {};
+
+    // Each variable is compared with its successor
+    // by expanding the list against a copy shifted by one.
+    template<auto...Previous, auto...Current>
+    struct Detail<Shuttle<Previous...>, Shuttle<Current...>>
+    {
+        // `ends[I]` is true if a run ends right before `I`.
+        // The first entry compares `Sentinel` with the first variable,
+        // and the last entry closes the final run.
+        static constexpr std::array<bool, sizeof...(Current)> ends
+        {(not SolitaryIsSame<Previous, Current>::value)...};
+
+        struct Runs
+        {
+            std::array<size_t, sizeof...(Variables)> lengths {};
+            size_t size {0};
+        };
+
+        static constexpr Runs runs
+        {
+            []()
+            {
+                Runs result {};
+                size_t start {0};
+
+                for (size_t i {1}; i < sizeof...(Current); i++)
+                {
+                    if (ends[i])
+                    {
+                        result.lengths[result.size++] = i - start;
+                        start = i;
+                    }
+                }
+
+                return result;
+            }()
+        };
+
+        template<typename>
+        struct Hidden {};
+
+        template<size_t...I>
+        struct Hidden<std::index_sequence<I...>>
+        { using type = Shuttle<runs.lengths[I]...>; };
+
+        // The last variable of each run represents the run.
+        using Distinct = Paste
+        <
+            Shuttle<>,
+            std::conditional_t
+            <
+                SolitaryIsSame<Previous, Current>::value
+                || SolitaryIsSame<Previous, Sentinel{}>::value,
+                Shuttle<>,
+                Shuttle<Previous>
+            >...
+        >::type;
+
+        using Counts = Hidden<std::make_index_sequence<runs.size>>::type;
+    };
+
+    using Encoding = Detail
+    <
+        Shuttle<Sentinel{}, Variables...>,
+        Shuttle<Variables..., Sentinel{}>
+    >;
+
+    using Distinct = Encoding::Distinct;
+
+    using Counts = Encoding::Counts;
+
+    using type = Capsule<Distinct, Counts>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+/**** Metafunction ****/
+using Metafunction = RunLengthEncode<1, 1, 1u, 2, 2, 2>;
+
+/**** SupposedResult ****/
+using SupposedDistinct = Shuttle<1, 1u, 2>;
+using SupposedCounts = Shuttle<size_t{2}, size_t{1}, size_t{3}>;
+
+/**** Tests ****/
+static_assert(std::same_as<Metafunction::Distinct, SupposedDistinct>);
+static_assert(std::same_as<Metafunction::Counts, SupposedCounts>);
\ No newline at end of file
@@ -0,0 +1,133 @@
+/**********************/
+/**** Dependencies ****/
+/**********************/
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+/**** Vay ****/
+template<auto Variable>
+struct Vay { static constexpr auto value {Variable}; };
+
+/**** Label ****/
+template<typename Treasure, typename Key>
+struct Label
+{ 
+    static constexpr auto idyl(Key) -> Treasure;
+};
+
+/**** Amid ****/
+template<auto...Variables>
+struct Amid
+{
+    template<typename>
+    struct Detail {};
+
+    template<size_t...I>
+    struct Detail<std::index_sequence<I...>>
+    : public Label<Vay<Variables>, std::integral_constant<size_t, I>>...
+    { using Label<Vay<Variables>, std::integral_constant<size_t, I>>::idyl...; };
+
+    template<size_t I>
+    static constexpr auto Page_v
+    {
+        decltype
+        (
+            Detail<std::make_index_sequence<sizeof...(Variables)>>
+            ::idyl(std::integral_constant<size_t, I>{})
+        )::value
+    };
+};
+
+/************************/
+/**** Implementation ****/
+/************************/
+
+template<auto...Variables>
+struct Scatter
+{
+    template<size_t...Indices>
+    requires ((Indices < sizeof...(Variables)) && ...)
+    struct ProtoPage
+    {
+        // `slots[I]` is one past the position of the replacement for `Variables[I]`,
+        // or zero if `Variables[I]` is kept.
+        // A later index overwrites an earlier one.
+        static constexpr auto slots
+        {
+            []()
+            {
+                std::array<size_t, sizeof...(Variables)> slots {};
+                size_t slot {};
+                ((slots[Indices] = ++slot), ...);
+                return slots;
+            }()
+        };
+
+        struct Slash
+        {
+            template<auto...Replacements>
+            requires (sizeof...(Replacements) == sizeof...(Indices))
+            struct ProtoPage
+            {
+                template<size_t Slot, auto Variable>
+                struct Pick
+                {
+                    static constexpr auto value
+                    {Amid<Replacements...>::template Page_v<Slot - 1>};
+                };
+
+                template<auto Variable>
+                struct Pick<0, Variable>
+                {
+                    static constexpr auto value {Variable};
+                };
+
+                template<template<auto...> class Operation, typename>
+                struct Detail {};
+
+                template<template<auto...> class Operation, size_t...I>
+                struct Detail<Operation, std::index_sequence<I...>>
+                {
+                    using type = Operation<Pick<slots[I], Variables>::value...>;
+                };
+
+                template<template<auto...> class...Agreements>
+                using Rail = Detail
+                <
+                    Agreements...,
+                    std::make_index_sequence<sizeof...(Variables)>
+                >::type;
+            };
+        };
+
+        template<auto...Agreements>
+        using Page = Slash::template ProtoPage<Agreements...>;
+    };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+/*****************/
+/**** Example ****/
+/*****************/
+
+#include <concepts>
+
+/**** Operation ****/
+template<auto...>
+struct Operation;
+
+/**** SupposedResult ****/
+using SupposedResult = Operation<nullptr, 1, 2, 'a'>;
+
+/**** Result ****/
+using Result = Scatter<0, 1, 2, 3>
+::Page<3, 0>
+::Page<'a', nullptr>
+::Rail<Operation>;
+
+/**** Test ****/
+static_assert(std::same_as<Result, SupposedResult>);
@@ -0,0 +1,161 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_PERFORMANCE_TESTS_TEST_ALL_CONST_QUALIFIED_H
+#define CONCEPTRODON_FUNCTIVORE_PERFORMANCE_TESTS_TEST_ALL_CONST_QUALIFIED_H
+
+#include <type_traits>
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/concepts/functivore/all_const_qualified.hpp"
+#include "conceptrodon/concepts/functivore/collapsed_all_const_qualified.hpp"
+#include "conceptrodon/concepts/mouldivore/all_passed.hpp"
+#include "conceptrodon/concepts/mouldivore/collapsed_all_passed.hpp"
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+namespace PerformanceTests {
+namespace TestAllConstQualified {
+
+
+
+
+// Overload resolution of a function template constrained by a concept over 240 arguments.
+// `probe` pits the constrained overload against an unconstrained fallback.
+// `rank` pits it against an overload whose constraint subsumes it,
+// so the compiler also has to compare the normalized constraints.
+// The switch selects the collapsed form, which evaluates the pack into one variable.
+#if CONCEPTRODON_TEST_ALTERNATIVE_SWITCH
+
+
+
+
+/******************************************************************************************************/
+template<int I>
+struct FO
+{
+    int operator()(int) const { return I; }
+};
+
+template<typename...Args>
+requires CollapsedAllConstQualified<Args...>
+constexpr auto probe(Capsule<Args...>) -> int
+{ return 1; }
+
+constexpr auto probe(auto) -> int
+{ return 0; }
+
+template<typename...Args>
+requires CollapsedAllConstQualified<Args...>
+constexpr auto rank(Capsule<Args...>) -> int
+{ return 1; }
+
+template<typename...Args>
+requires CollapsedAllConstQualified<Args...>
+&&  Mouldivore::CollapsedAllPassed<std::is_class, Args...>
+constexpr auto rank(Capsule<Args...>) -> int
+{ return 2; }
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SHEEP_PREFIX    \
+    FO<
+#define SHEEP_SUFFIX    \
+    >
+#define SHEEP_SEPARATOR \
+    ,
+
+VALID(probe(Capsule<SHEEP_SPROUT(240)>{}) == 1);
+VALID(probe(Capsule<SHEEP_SPROUT(240, +240)>{}) == 1);
+VALID(probe(Capsule<SHEEP_SPROUT(240, +480)>{}) == 1);
+VALID(probe(Capsule<SHEEP_SPROUT(240, +720)>{}) == 1);
+
+VALID(rank(Capsule<SHEEP_SPROUT(240)>{}) == 2);
+VALID(rank(Capsule<SHEEP_SPROUT(240, +240)>{}) == 2);
+VALID(rank(Capsule<SHEEP_SPROUT(240, +480)>{}) == 2);
+VALID(rank(Capsule<SHEEP_SPROUT(240, +720)>{}) == 2);
+
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+#else
+
+
+
+
+/******************************************************************************************************/
+template<int I>
+struct FO
+{
+    int operator()(int) const { return I; }
+};
+
+template<typename...Args>
+requires AllConstQualified<Args...>
+constexpr auto probe(Capsule<Args...>) -> int
+{ return 1; }
+
+constexpr auto probe(auto) -> int
+{ return 0; }
+
+template<typename...Args>
+requires AllConstQualified<Args...>
+constexpr auto rank(Capsule<Args...>) -> int
+{ return 1; }
+
+template<typename...Args>
+requires AllConstQualified<Args...>
+&&  Mouldivore::AllPassed<std::is_class, Args...>
+constexpr auto rank(Capsule<Args...>) -> int
+{ return 2; }
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SHEEP_PREFIX    \
+    FO<
+#define SHEEP_SUFFIX    \
+    >
+#define SHEEP_SEPARATOR \
+    ,
+
+VALID(probe(Capsule<SHEEP_SPROUT(240)>{}) == 1);
+VALID(probe(Capsule<SHEEP_SPROUT(240, +240)>{}) == 1);
+VALID(probe(Capsule<SHEEP_SPROUT(240, +480)>{}) == 1);
+VALID(probe(Capsule<SHEEP_SPROUT(240, +720)>{}) == 1);
+
+VALID(rank(Capsule<SHEEP_SPROUT(240)>{}) == 2);
+VALID(rank(Capsule<SHEEP_SPROUT(240, +240)>{}) == 2);
+VALID(rank(Capsule<SHEEP_SPROUT(240, +480)>{}) == 2);
+VALID(rank(Capsule<SHEEP_SPROUT(240, +720)>{}) == 2);
+
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+#endif
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_PERFORMANCE_TESTS_TEST_ALL_PASSED_H
+#define CONCEPTRODON_TYPELIVORE_PERFORMANCE_TESTS_TEST_ALL_PASSED_H
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/concepts/typelivore/all_passed.hpp"
+#include "conceptrodon/concepts/typelivore/collapsed_all_passed.hpp"
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace PerformanceTests {
+namespace TestAllPassed {
+
+
+
+
+// Overload resolution of a function template constrained by a concept over 240 arguments.
+// `probe` pits the constrained overload against an unconstrained fallback.
+// `rank` pits it against an overload whose constraint subsumes it,
+// so the compiler also has to compare the normalized constraints.
+// The switch selects the collapsed form, which evaluates the pack into one variable.
+#if CONCEPTRODON_TEST_ALTERNATIVE_SWITCH
+
+
+
+
+/******************************************************************************************************/
+struct NonNegative
+{
+    constexpr bool operator()(auto para)
+    { return para >= 0; }
+};
+
+template<auto...Args>
+requires CollapsedAllPassed<NonNegative, Args...>
+constexpr auto probe(Shuttle<Args...>) -> int
+{ return 1; }
+
+constexpr auto probe(auto) -> int
+{ return 0; }
+
+struct Bounded
+{
+    constexpr bool operator()(auto para)
+    { return para < 1000; }
+};
+
+template<auto...Args>
+requires CollapsedAllPassed<NonNegative, Args...>
+constexpr auto rank(Shuttle<Args...>) -> int
+{ return 1; }
+
+template<auto...Args>
+requires CollapsedAllPassed<NonNegative, Args...>
+&&  CollapsedAllPassed<Bounded, Args...>
+constexpr auto rank(Shuttle<Args...>) -> int
+{ return 2; }
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SHEEP_PREFIX    \
+    
+#define SHEEP_SUFFIX    \
+    
+#define SHEEP_SEPARATOR \
+    ,
+
+VALID(probe(Shuttle<SHEEP_SPROUT(240)>{}) == 1);
+VALID(probe(Shuttle<SHEEP_SPROUT(240, +240)>{}) == 1);
+VALID(probe(Shuttle<SHEEP_SPROUT(240, +480)>{}) == 1);
+VALID(probe(Shuttle<SHEEP_SPROUT(240, +720)>{}) == 1);
+
+VALID(rank(Shuttle<SHEEP_SPROUT(240)>{}) == 2);
+VALID(rank(Shuttle<SHEEP_SPROUT(240, +240)>{}) == 2);
+VALID(rank(Shuttle<SHEEP_SPROUT(240, +480)>{}) == 2);
+VALID(rank(Shuttle<SHEEP_SPROUT(240, +720)>{}) == 2);
+
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+#else
+
+
+
+
+/******************************************************************************************************/
+struct NonNegative
+{
+    constexpr bool operator()(auto para)
+    { return para >= 0; }
+};
+
+template<auto...Args>
+requires AllPassed<NonNegative, Args...>
+constexpr auto probe(Shuttle<Args...>) -> int
+{ return 1; }
+
+constexpr auto probe(auto) -> int
+{ return 0; }
+
+struct Bounded
+{
+    constexpr bool operator()(auto para)
+    { return para < 1000; }
+};
+
+template<auto...Args>
+requires AllPassed<NonNegative, Args...>
+constexpr auto rank(Shuttle<Args...>) -> int
+{ return 1; }
+
+template<auto...Args>
+requires AllPassed<NonNegative, Args...>
+&&  AllPassed<Bounded, Args...>
+constexpr auto rank(Shuttle<Args...>) -> int
+{ return 2; }
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SHEEP_PREFIX    \
+    
+#define SHEEP_SUFFIX    \
+    
+#define SHEEP_SEPARATOR \
+    ,
+
+VALID(probe(Shuttle<SHEEP_SPROUT(240)>{}) == 1);
+VALID(probe(Shuttle<SHEEP_SPROUT(240, +240)>{}) == 1);
+VALID(probe(Shuttle<SHEEP_SPROUT(240, +480)>{}) == 1);
+VALID(probe(Shuttle<SHEEP_SPROUT(240, +720)>{}) == 1);
+
+VALID(rank(Shuttle<SHEEP_SPROUT(240)>{}) == 2);
+VALID(rank(Shuttle<SHEEP_SPROUT(240, +240)>{}) == 2);
+VALID(rank(Shuttle<SHEEP_SPROUT(240, +480)>{}) == 2);
+VALID(rank(Shuttle<SHEEP_SPROUT(240, +720)>{}) == 2);
+
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+#endif
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
@@ -0,0 +1,105 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_PERFORMANCE_TESTS_TEST_TABULATE_H
+#define CONCEPTRODON_FUNCTIVORE_PERFORMANCE_TESTS_TEST_TABULATE_H
+
+#include "conceptrodon/metafunctions/functivore/tabulate.hpp"
+#include "conceptrodon/metafunctions/functivore/get_return_type.hpp"
+#include "conceptrodon/metafunctions/functivore/get_parameter_types.hpp"
+#include "conceptrodon/metafunctions/functivore/is_noexcept.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+namespace PerformanceTests {
+namespace TestTabulate {
+
+
+
+
+/******************************************************************************************************/
+template<auto>
+struct Marker {};
+
+template<auto I>
+struct Handler
+{
+    Marker<I> operator()(Marker<I>, int) const noexcept { return {}; }
+};
+
+#define SHEEP_PREFIX    \
+    Handler<
+#define SHEEP_SUFFIX    \
+    > const&
+#define SHEEP_SEPARATOR \
+    ,
+/******************************************************************************************************/
+
+
+
+
+#if CONCEPTRODON_TEST_ALTERNATIVE_SWITCH
+
+
+
+
+/******************************************************************************************************/
+// Each column is produced by its own facility.
+template<typename...Callables>
+struct Columns
+{
+    static constexpr size_t size {sizeof...(Callables)};
+
+    using return_types = Capsule<GetReturnType<Callables>...>;
+
+    using parameter_types = Capsule<typename GetParameterTypes<Capsule>::template Mold<Callables>...>;
+
+    using flags = Shuttle<IsNoexcept_v<Callables>...>;
+};
+
+VALID(Columns<SHEEP_SPROUT(300)>::size);
+/******************************************************************************************************/
+
+
+
+
+#else
+
+
+
+
+/******************************************************************************************************/
+VALID(Tabulate<Capsule<SHEEP_SPROUT(300)>>::size);
+/******************************************************************************************************/
+
+
+
+
+#endif
+
+
+
+
+/******************************************************************************************************/
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_PERFORMANCE_TESTS_TEST_SKIP_H
+#define CONCEPTRODON_MOULDIVORE_PERFORMANCE_TESTS_TEST_SKIP_H
+
+#include "conceptrodon/metafunctions/microbiota/ominuci/trail.hpp"
+#include "conceptrodon/metafunctions/omennivore/press.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace PerformanceTests {
+namespace TestSkip {
+
+
+
+
+/******************************************************************************************************/
+template<typename...>
+struct Operation
+{
+    template<auto...>
+    using Page = Operation<>;
+
+    static constexpr bool value {true};
+};
+
+#define SHEEP_PREFIX    \
+    ::Page<
+#define SHEEP_SUFFIX    \
+    >
+#define SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+#if CONCEPTRODON_TEST_ALTERNATIVE_SWITCH
+
+
+
+
+/******************************************************************************************************/
+// The previous record: every step copies all arguments collected so far.
+template<template<typename...> class Operation, typename...Items>
+struct FlatLoadSkip
+{
+    struct Commit
+    {
+        template<typename...Elements>
+        using Mold = Omennivore::Press<Operation<Elements...>>::template Mold<Items...>;
+    };
+
+    template<auto...Variables>
+    using Page = FlatLoadSkip<Operation, Items..., Shuttle<Variables...>>;
+};
+
+VALID(FlatLoadSkip<Operation>SHEEP_SPROUT(480)::Commit::Mold<>::value);
+/******************************************************************************************************/
+
+
+
+
+#else
+
+
+
+
+/******************************************************************************************************/
+// The current record: every step adds a single link.
+template<template<typename...> class Operation, typename Record = void>
+struct ChainedLoadSkip
+{
+    struct Commit
+    {
+        template<typename...Elements>
+        struct ProtoMold
+        { using type = Ominuci::Retrace<Operation<Elements...>, Record>::type; };
+
+        template<typename...Agreements>
+        using Mold = ProtoMold<Agreements...>::type;
+    };
+
+    template<auto...Variables>
+    struct ProtoPage
+    { using type = ChainedLoadSkip<Operation, Ominuci::Trail<Record, Shuttle<Variables...>>>; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>::type;
+};
+
+VALID(ChainedLoadSkip<Operation>SHEEP_SPROUT(480)::Commit::Mold<>::value);
+/******************************************************************************************************/
+
+
+
+
+#endif
+
+
+
+
+/******************************************************************************************************/
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_PERFORMANCE_TESTS_TEST_INDEX_H
+#define CONCEPTRODON_TYPELIVORE_PERFORMANCE_TESTS_TEST_INDEX_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "conceptrodon/metafunctions/typelivore/index.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+
+// Calibrates the thresholds of `Typelivore::Index`.
+// Every compilation measures one cell of the sweep on 64 distinct packs:
+// - `CONCEPTRODON_TEST_INDEX_LENGTH` is the pack length, swept over 16, 32, 64, 128 and 256;
+// - `CONCEPTRODON_TEST_INDEX_LOOKUPS` is the number of lookups on each pack, swept over 1, 4, 8 and 16.
+// Compile every cell once per strategy by defining `CONCEPTRODON_TYPELIVORE_INDEX_STRATEGY`
+// as `Among`, `Amid` and `Amidst`, and once without it.
+// The longest pack on which `Amidst` still wins with one lookup is
+// `CONCEPTRODON_TYPELIVORE_INDEX_AMIDST_LIMIT`.
+// The smallest lookup count from which `Amid` beats `Among` is
+// `CONCEPTRODON_TYPELIVORE_INDEX_AMID_LOOKUPS`.
+//
+// Only `Amid` compiles on GCC. With GCC 12 and `-fsyntax-only`, the `Amid` cells take
+// (milliseconds per compilation, best of two, lengths by row, lookups by column):
+//
+//          1       4       8      16
+//   16   107     144     181     244
+//   32   128     182     227     372
+//   64   210     276     348     520
+//  128   413     499     607     872
+//  256   849    1063    1320    2000
+//
+// These only serve as a baseline; the thresholds need the Clang sweep.
+
+#ifndef CONCEPTRODON_TEST_INDEX_LENGTH
+#define CONCEPTRODON_TEST_INDEX_LENGTH 64
+#endif
+
+#ifndef CONCEPTRODON_TEST_INDEX_LOOKUPS
+#define CONCEPTRODON_TEST_INDEX_LOOKUPS 1
+#endif
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace PerformanceTests {
+namespace TestIndex {
+
+
+
+
+/******************************************************************************************************/
+template<size_t, size_t>
+struct Element {};
+
+// The lookups are spread evenly over the pack.
+template<size_t Pack, typename, typename>
+struct Probe {};
+
+template<size_t Pack, size_t...I, size_t...J>
+struct Probe<Pack, std::index_sequence<I...>, std::index_sequence<J...>>
+{
+    using Strategy = Index<Element<Pack, I>...>::template Expect<sizeof...(J)>;
+
+    static constexpr bool value
+    {(
+        std::is_same_v
+        <
+            typename Strategy::template Page<J * sizeof...(I) / sizeof...(J)>,
+            Element<Pack, J * sizeof...(I) / sizeof...(J)>
+        >
+        && ...
+    )};
+};
+
+// Every pack is distinct, so that no pack can reuse the work of another.
+template<typename>
+struct Sweep {};
+
+template<size_t...Pack>
+struct Sweep<std::index_sequence<Pack...>>
+{
+    static constexpr bool value
+    {(
+        Probe
+        <
+            Pack,
+            std::make_index_sequence<CONCEPTRODON_TEST_INDEX_LENGTH>,
+            std::make_index_sequence<CONCEPTRODON_TEST_INDEX_LOOKUPS>
+        >::value
+        && ...
+    )};
+};
+
+VALID(Sweep<std::make_index_sequence<64>>::value);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+
+#endif
@@ -0,0 +1,111 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_PERFORMANCE_TESTS_TEST_ROPE_H
+#define CONCEPTRODON_TYPELIVORE_PERFORMANCE_TESTS_TEST_ROPE_H
+
+#include <cstddef>
+#include "conceptrodon/metafunctions/typelivore/rope.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace PerformanceTests {
+namespace TestRope {
+
+
+
+
+/******************************************************************************************************/
+template<size_t>
+struct Element;
+
+template<typename...>
+struct Operation
+{ static constexpr bool value {true}; };
+
+// 3000 elements are appended one by one in 60 blocks of 50 steps.
+// Each block is a separate recursion, which keeps the template depth
+// far below the default limit of `-ftemplate-depth`.
+template<template<typename, size_t> class Step, typename Origin, size_t Blocks>
+struct Repeat
+{
+    using type = Repeat
+    <
+        Step,
+        typename Step<Origin, Blocks * 50>::type,
+        Blocks - 1
+    >::type;
+};
+
+template<template<typename, size_t> class Step, typename Origin>
+struct Repeat<Step, Origin, 0>
+{ using type = Origin; };
+/******************************************************************************************************/
+
+
+
+
+#if CONCEPTRODON_TEST_ALTERNATIVE_SWITCH
+
+
+
+
+/******************************************************************************************************/
+// Every step copies the accumulated list.
+template<typename Origin, size_t N, size_t Steps = 50>
+struct Append
+{ using type = Origin; };
+
+template<typename...Elements, size_t N, size_t Steps>
+requires (Steps != 0)
+struct Append<Capsule<Elements...>, N, Steps>
+{ using type = Append<Capsule<Elements..., Element<N>>, N - 1, Steps - 1>::type; };
+
+template<typename Origin, size_t N>
+using Block = Append<Origin, N>;
+
+VALID(Repeat<Block, Capsule<>, 60>::type::UniRoad<Operation>::value);
+/******************************************************************************************************/
+
+
+
+
+#else
+
+
+
+
+/******************************************************************************************************/
+// Every step knots the rope; the list is collected once.
+template<typename Origin, size_t N, size_t Steps = 50>
+struct Append
+{ using type = Append<typename Origin::template Paste<Rope<Element<N>>>, N - 1, Steps - 1>::type; };
+
+template<typename Origin, size_t N>
+struct Append<Origin, N, 0>
+{ using type = Origin; };
+
+template<typename Origin, size_t N>
+using Block = Append<Origin, N>;
+
+VALID(Repeat<Block, Rope<>, 60>::type::UniRoad<Operation>::value);
+/******************************************************************************************************/
+
+
+
+
+#endif
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+
+#endif
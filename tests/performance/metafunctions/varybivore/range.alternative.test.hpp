@@ -0,0 +1,85 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_PERFORMANCE_TESTS_TEST_RANGE_H
+#define CONCEPTRODON_VARYBIVORE_PERFORMANCE_TESTS_TEST_RANGE_H
+
+#include "conceptrodon/metafunctions/varybivore/range.hpp"
+#include "conceptrodon/metafunctions/varybivore/slice.hpp"
+#include "conceptrodon/metafunctions/varybivore/erase.hpp"
+#include "conceptrodon/metafunctions/varybivore/rotate.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace PerformanceTests {
+namespace TestRange {
+
+
+
+
+/******************************************************************************************************/
+template<auto...>
+struct Operation
+{ static constexpr bool value {true}; };
+/******************************************************************************************************/
+
+
+
+
+#if CONCEPTRODON_TEST_ALTERNATIVE_SWITCH
+
+
+
+
+/******************************************************************************************************/
+// Every step materializes the variables.
+#include "macaron/fragmental/amenity/instances/define_integer_sheep.hpp"
+VALID
+(
+    Slice<SHEEP_SPROUT(480)>::Page<40, 440>
+    ::Rail<Erase>::Page<100, 200>
+    ::Rail<Rotate>::Page<30>
+    ::Rail<Operation>::value
+);
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+#else
+
+
+
+
+/******************************************************************************************************/
+// Variables are only materialized by the final `Rail`.
+VALID
+(
+    Range<0, 480>::Slice<40, 440>
+    ::Erase<100, 200>
+    ::Rotate<30>
+    ::Rail<Operation>::value
+);
+/******************************************************************************************************/
+
+
+
+
+#endif
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
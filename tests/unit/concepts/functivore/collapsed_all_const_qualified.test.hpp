@@ -0,0 +1,89 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_CONST_QUALIFIED_H
+#define CONCEPTRODON_FUNCTIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_CONST_QUALIFIED_H
+
+#include "conceptrodon/concepts/functivore/collapsed_all_const_qualified.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+namespace UnitTests {
+namespace TestCollapsedAllConstQualified {
+
+
+
+
+/******************************************************************************************************/
+/**** functions ****/
+inline int fun_0(int, double){ return 0; }
+
+/**** pointer to member functions ****/
+struct Tester
+{
+    inline int fun_0(int, double){ return 0; }
+
+    inline int gun_0(int const, double&...) const { return 0; }
+    inline int gun_1(int const, double&...) const volatile & noexcept { return 0; }
+};
+
+/**** function objects ****/
+struct FO_0
+{
+    int operator()(int, double){ return 0; }
+};
+
+struct FO_1
+{
+    int operator()(int const, double&...) const { return 0; }
+};
+
+/**** lambda expressions ****/
+inline auto Lambda_0
+{
+    [](int, double)
+    { return 0; }
+};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+static_assert
+(
+    CollapsedAllConstQualified
+    <
+        decltype(&Tester::gun_0),
+        decltype(&Tester::gun_1),
+        FO_1,
+        decltype(Lambda_0)
+    >
+);
+
+static_assert
+(
+    ! CollapsedAllConstQualified
+    <
+        decltype(fun_0),
+        decltype(&Tester::gun_0),
+        FO_1
+    >
+);
+
+static_assert
+(
+    ! CollapsedAllConstQualified
+    <
+        decltype(&Tester::fun_0),
+        FO_0
+    >
+);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#endif
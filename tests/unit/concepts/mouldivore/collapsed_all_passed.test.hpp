@@ -0,0 +1,58 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_PASSED_H
+#define CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_PASSED_H
+
+#include <type_traits>
+#include "conceptrodon/concepts/mouldivore/collapsed_all_passed.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace UnitTests {
+namespace TestCollapsedAllPassed {
+
+
+
+
+/******************************************************************************************************/
+static_assert(CollapsedAllPassed<std::is_integral, int, long, char>);
+static_assert(! CollapsedAllPassed<std::is_integral, int, double, char>);
+static_assert(CollapsedAllPassed<std::is_integral>);
+static_assert(CollapsedAllPassed_v<std::is_integral, int, long>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+template<typename>
+struct Valueless {};
+
+// A predicate without a value member fails the concept instead of the compilation.
+static_assert(! CollapsedAllPassed<Valueless, int>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+template<typename...>
+struct Tester
+{ static constexpr int value {0}; };
+
+template<typename...Args>
+requires CollapsedAllPassed<std::is_integral, Args...>
+struct Tester<Args...>
+{ static constexpr int value {1}; };
+
+static_assert(Tester<int, long>::value == 1);
+static_assert(Tester<int, float>::value == 0);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#endif
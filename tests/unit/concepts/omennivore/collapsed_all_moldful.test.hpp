@@ -0,0 +1,28 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_MOLDFUL_H
+#define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_MOLDFUL_H
+
+#include "conceptrodon/concepts/omennivore/collapsed_all_moldful.hpp"
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vehicle.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+namespace UnitTests {
+namespace TestCollapsedAllMoldful {
+
+static_assert(CollapsedAllMoldful<Capsule<>, Capsule<int>>);
+
+static_assert(! CollapsedAllMoldful<Capsule<>, Shuttle<0>>);
+
+static_assert(! CollapsedAllMoldful<Vehicle<>, Vehicle<Capsule>>);
+
+static_assert(! CollapsedAllMoldful<int, Capsule<int>>);
+
+}}}}
+
+#endif
@@ -0,0 +1,57 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_PASSED_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_PASSED_H
+
+#include "conceptrodon/concepts/typelivore/collapsed_all_passed.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestCollapsedAllPassed {
+
+
+
+
+/******************************************************************************************************/
+template<auto Arg>
+struct AreGreaterThan
+{
+    constexpr bool operator()(auto para)
+    { return para > Arg; }
+};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+static_assert(CollapsedAllPassed<AreGreaterThan<0>, 1, 2, 3>);
+static_assert(! CollapsedAllPassed<AreGreaterThan<0>, 0, 2, 3>);
+static_assert(CollapsedAllPassed_v<AreGreaterThan<0>, 1, 2, 3>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+template<auto...>
+struct Tester
+{ static constexpr int value {-1}; };
+
+template<auto...Args>
+requires CollapsedAllPassed<AreGreaterThan<0>, Args...>
+struct Tester<Args...>
+{ static constexpr int value {0}; };
+
+static_assert(Tester<1, 2, 3>::value == 0);
+static_assert(Tester<0, 2, 3>::value == -1);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_ZERO_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_COLLAPSED_ALL_ZERO_H
+
+#include "conceptrodon/concepts/typelivore/collapsed_all_zero.hpp"
+#include "conceptrodon/utilities/vay.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestCollapsedAllZero {
+
+
+
+
+/******************************************************************************************************/
+template<typename...>
+struct Tester
+{ static constexpr bool value {false}; };
+
+template<typename...I>
+requires CollapsedAllZero<I...>
+struct Tester<I...>
+{ static constexpr bool value {true}; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+static_assert(! Tester<Vay<1>, Vay<2>, Vay<3>>::value);
+static_assert(! Tester<Vay<-1>, Vay<0>, Vay<-1>>::value);
+static_assert(Tester<Vay<0>, Vay<0>, Vay<0>>::value);
+static_assert(! Tester<Vay<0>, int>::value);
+static_assert(CollapsedAllZero_v<Vay<0>, Vay<0>>);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#endif
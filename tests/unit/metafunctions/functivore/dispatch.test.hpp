@@ -0,0 +1,186 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_UNIT_TESTS_TEST_DISPATCH_H
+#define CONCEPTRODON_FUNCTIVORE_UNIT_TESTS_TEST_DISPATCH_H
+
+#include <variant>
+
+#include "conceptrodon/metafunctions/functivore/dispatch.hpp"
+
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Functivore {
+namespace UnitTests {
+namespace TestDispatch {
+
+
+
+
+/******************************************************************************************************/
+struct Ping { int count; };
+struct Pong { int count; };
+struct Quit {};
+
+struct Counter
+{
+    int total {0};
+    constexpr void operator()(Ping const& ping) { total += ping.count; }
+};
+
+struct Logger
+{
+    int total {0};
+    constexpr void operator()(Ping ping) { total += 10 * ping.count; }
+};
+
+struct Responder
+{
+    int total {0};
+    constexpr void operator()(Pong const& pong) { total += 100 * pong.count; }
+};
+
+using Metafunction = Dispatch<Counter, Logger, Responder>
+::Mold<Ping, Pong, Quit>;
+
+constexpr int dispatch(std::variant<Ping, Pong, Quit> const& event)
+{
+    Counter counter {};
+    Logger logger {};
+    Responder responder {};
+    Metafunction::dispatch(event, counter, logger, responder);
+    return counter.total + logger.total + responder.total;
+}
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    3
+
+EQUAL_VALUE(Metafunction::value.size());
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    2
+
+EQUAL_VALUE(Metafunction::routes<Ping>.size());
+EQUAL_VALUE(Metafunction::routes<Pong>[0]);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    0
+
+EQUAL_VALUE(Metafunction::routes<Quit>.size());
+EQUAL_VALUE(dispatch(Quit{}));
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    22
+
+EQUAL_VALUE(dispatch(Ping{2}));
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    300
+
+EQUAL_VALUE(dispatch(Pong{3}));
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+/******************************************************************************************************/
+// `Mutator` and `Consumer` cannot bind `Ping const&`, and `Pair` takes two parameters.
+// None of them is routed.
+struct Mutator
+{
+    int total {0};
+    constexpr void operator()(Ping& ping) { total += ping.count; }
+};
+
+struct Consumer
+{
+    int total {0};
+    constexpr void operator()(Ping&& ping) { total += ping.count; }
+};
+
+struct Pair
+{
+    int total {0};
+    constexpr void operator()(Ping const& ping, int) { total += ping.count; }
+};
+
+using Metafunction_1 = Dispatch<Mutator, Consumer, Pair, Counter>
+::Mold<Ping, Pong>;
+
+constexpr int dispatch_1(std::variant<Ping, Pong> const& event)
+{
+    Mutator mutator {};
+    Consumer consumer {};
+    Pair pair {};
+    Counter counter {};
+    Metafunction_1::dispatch(event, mutator, consumer, pair, counter);
+    return mutator.total + consumer.total + pair.total + counter.total;
+}
+
+#define SUPPOSED_VALUE \
+    1
+
+EQUAL_VALUE(Metafunction_1::routes<Ping>.size());
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE \
+    3
+
+EQUAL_VALUE(Metafunction_1::routes<Ping>[0]);
+EQUAL_VALUE(dispatch_1(Ping{3}));
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE \
+    0
+
+EQUAL_VALUE(Metafunction_1::routes<Pong>.size());
+EQUAL_VALUE(dispatch_1(Pong{3}));
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
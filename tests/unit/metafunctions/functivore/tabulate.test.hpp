@@ -0,0 +1,144 @@
+// Copyright 2025 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_FUNCTIVORE_UNIT_TESTS_TEST_TABULATE_H
+#define CONCEPTRODON_FUNCTIVORE_UNIT_TESTS_TEST_TABULATE_H
+
+#include "conceptrodon/metafunctions/functivore/tabulate.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include <concepts>
+#include <array>
+
+
+
+
+/******************************************************************************************************/
+#ifdef CONCEPTRODON_NUCLEOLUS_NOEXCEPT_FLAG
+#error "CONCEPTRODON_NUCLEOLUS_NOEXCEPT_FLAG has already been defined"
+#endif
+
+#include "conceptrodon/metafunctions/microbiota/nucleolus/define_flags/noexcept.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#ifdef CONCEPTRODON_NUCLEOLUS_FUNCTION_POINTER_FLAG
+#error "CONCEPTRODON_NUCLEOLUS_FUNCTION_POINTER_FLAG has already been defined"
+#endif
+
+#include "conceptrodon/metafunctions/microbiota/nucleolus/define_flags/function_pointer.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#ifdef CONCEPTRODON_NUCLEOLUS_FUNCTION_OBJECT_FLAG
+#error "CONCEPTRODON_NUCLEOLUS_FUNCTION_OBJECT_FLAG has already been defined"
+#endif
+
+#include "conceptrodon/metafunctions/microbiota/nucleolus/define_flags/function_object.hpp"
+/******************************************************************************************************/
+
+
+
+
+namespace Conceptrodon {
+namespace Functivore {
+namespace UnitTests {
+namespace TestTabulate {
+
+
+
+
+/******************************************************************************************************/
+/**** functions ****/
+inline int fun_0(int, double){ return 0; }
+inline void fun_1(char) noexcept {}
+
+/**** function pointers ****/
+inline auto FunP_0 { fun_0 };
+
+/**** function objects ****/
+struct FO_0
+{
+    double operator()(int const, double&...) const noexcept { return 0; }
+};
+
+/**** lambda expressions ****/
+inline auto Lambda_0
+{
+    [](int, double)
+    { return 0; }
+};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+using Table = Tabulate<Capsule<decltype(fun_0), decltype(fun_1), decltype(FunP_0), FO_0 const&, decltype(Lambda_0)>>;
+
+static_assert(Table::size == 5);
+
+static_assert(std::same_as<Table::return_types, Capsule<int, void, int, double, int>>);
+
+static_assert
+(
+    std::same_as
+    <
+        Table::parameter_types,
+        Capsule
+        <
+            Capsule<int, double>,
+            Capsule<char>,
+            Capsule<int, double>,
+            Capsule<int, double&>,
+            Capsule<int, double>
+        >
+    >
+);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+template<typename>
+struct GetFlags;
+
+template<auto...Flags>
+struct GetFlags<Shuttle<Flags...>>
+{ static constexpr std::array value {Flags...}; };
+
+constexpr auto flags {GetFlags<Table::flags>::value};
+
+static_assert(not (flags[0] & CONCEPTRODON_NUCLEOLUS_NOEXCEPT_FLAG));
+static_assert(flags[1] & CONCEPTRODON_NUCLEOLUS_NOEXCEPT_FLAG);
+static_assert(flags[2] & CONCEPTRODON_NUCLEOLUS_FUNCTION_POINTER_FLAG);
+static_assert(flags[3] & CONCEPTRODON_NUCLEOLUS_FUNCTION_OBJECT_FLAG);
+static_assert(flags[3] & CONCEPTRODON_NUCLEOLUS_NOEXCEPT_FLAG);
+static_assert(flags[4] & CONCEPTRODON_NUCLEOLUS_FUNCTION_OBJECT_FLAG);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+
+
+
+/******************************************************************************************************/
+#include "conceptrodon/metafunctions/microbiota/nucleolus/undef_flags/noexcept.hpp"
+#include "conceptrodon/metafunctions/microbiota/nucleolus/undef_flags/function_pointer.hpp"
+#include "conceptrodon/metafunctions/microbiota/nucleolus/undef_flags/function_object.hpp"
+/******************************************************************************************************/
+
+
+
+
+#endif
@@ -88,6 +88,23 @@ VALID
 
 
 
+/******************************************************************************************************/
+/**** Poisoned ****/
+// Fails to compile once instantiated.
+template<typename...Elements>
+struct Poisoned
+{
+    static_assert(sizeof...(Elements) == 0, "Poisoned should not be instantiated.");
+    static constexpr bool value {true};
+};
+
+// The predicates after the first failed one are not instantiated.
+INVALID(Conjunction<Pred_0, Pred_1, Poisoned>::Mold<std::integral_constant<int, -2>>::value);
+/******************************************************************************************************/
+
+
+
+
 }}}}
 
 #include "macaron/judgmental/amenity/undef_valid.hpp"
@@ -88,6 +88,23 @@ INVALID
 
 
 
+/******************************************************************************************************/
+/**** Poisoned ****/
+// Fails to compile once instantiated.
+template<typename...Elements>
+struct Poisoned
+{
+    static_assert(sizeof...(Elements) == 0, "Poisoned should not be instantiated.");
+    static constexpr bool value {true};
+};
+
+// The predicates after the first satisfied one are not instantiated.
+VALID(Disjunction<Pred_0, Poisoned>::Mold<std::integral_constant<int, 11>>::value);
+/******************************************************************************************************/
+
+
+
+
 }}}}
 
 #include "macaron/judgmental/amenity/undef_valid.hpp"
@@ -0,0 +1,99 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_FIND_ALL_H
+#define CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_FIND_ALL_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/mouldivore/find_all.hpp"
+#include "conceptrodon/metafunctions/typelivore/gather.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace UnitTests {
+namespace TestFindAll {
+
+
+
+
+/******************************************************************************************************/
+template<typename...>
+struct Operation;
+
+template<typename Element>
+struct IsPointer
+{ static constexpr bool value {std::is_pointer_v<Element>}; };
+
+template<typename Element>
+struct IsConst
+{ static constexpr bool value {std::is_const_v<std::remove_pointer_t<Element>>}; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{1}, size_t{3}, size_t{4}>
+
+SAME_TYPE(FindAll<IsPointer>::Mold<int, int*, int, int const*, double*>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{3}>
+
+SAME_TYPE(FindAll<IsPointer, IsConst>::Mold<int, int*, int, int const*, double*>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(FindAll<IsPointer>::Mold<int, double>);
+SAME_TYPE(FindAll<IsPointer>::Mold<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+static_assert(FindAll<IsPointer>::Mold_v<int, int*, int, int const*, double*>.size() == 3);
+static_assert(FindAll<IsPointer>::Mold_v<int, int*, int, int const*, double*>[2] == 4);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// The indices can be handed to `Gather` to extract the matches.
+#define SUPPOSED_TYPE   \
+    Operation<int*, int const*, double*>
+
+SAME_TYPE
+(
+    FindAll<IsPointer>::Mold<int, int*, int, int const*, double*>
+    ::Rail<Typelivore::Gather<int, int*, int, int const*, double*>::Page>
+    ::Road<Operation>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
@@ -0,0 +1,80 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_FOLD_LEFT_ALL_H
+#define CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_FOLD_LEFT_ALL_H
+
+#include <type_traits>
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/mouldivore/fold_left_all.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace UnitTests {
+namespace TestFoldLeftAll {
+
+
+
+
+/******************************************************************************************************/
+template<typename Left, typename Right>
+struct BinaryOperation
+{ using type = std::integral_constant<int, Left::value - Right::value>; };
+
+template<typename Left, typename Right>
+using BinaryOperation_t = BinaryOperation<Left, Right>::type;
+
+template<int I>
+using Int = std::integral_constant<int, I>;
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Ten elements take one step of eight and two single steps.
+#define SUPPOSED_TYPE   \
+    Capsule<Int<-1>, Int<-3>, Int<-6>, Int<-10>, Int<-15>, Int<-21>, Int<-28>, Int<-36>, Int<-45>, Int<-55>>
+
+SAME_TYPE
+(
+    FoldLeftAll<BinaryOperation_t>
+    ::Mold<Int<0>>
+    ::Mold<Int<1>, Int<2>, Int<3>, Int<4>, Int<5>, Int<6>, Int<7>, Int<8>, Int<9>, Int<10>>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Int<-1>>
+
+SAME_TYPE(FoldLeftAll<BinaryOperation_t>::Mold<Int<0>>::Mold<Int<1>>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(FoldLeftAll<BinaryOperation_t>::Mold<Int<0>>::Mold<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
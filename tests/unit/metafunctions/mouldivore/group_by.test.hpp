@@ -0,0 +1,80 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_GROUP_BY_H
+#define CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_GROUP_BY_H
+
+#include <type_traits>
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/mouldivore/group_by.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace UnitTests {
+namespace TestGroupBy {
+
+
+
+
+/******************************************************************************************************/
+template<typename Element>
+struct Size
+{ static constexpr auto value {sizeof(Element)}; };
+
+template<typename Element>
+struct IsPointer
+{ static constexpr bool value {std::is_pointer_v<Element>}; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Groups appear in the order their keys first appear.
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, float>, Capsule<double, long long>, Capsule<char, bool>>
+
+SAME_TYPE(GroupBy<Size>::Mold<int, double, char, float, long long, bool>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, char>, Capsule<int*, double*>>
+
+SAME_TYPE(GroupBy<IsPointer>::Mold<int, int*, char, double*>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int*, double*>>
+
+SAME_TYPE(GroupBy<IsPointer>::Mold<int*, double*>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(GroupBy<IsPointer>::Mold<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
@@ -4,6 +4,8 @@
 #ifndef CONCEPTRODON_MOULDVORE_UNIT_TESTS_TEST_LOOK_FOR_H
 #define CONCEPTRODON_MOULDVORE_UNIT_TESTS_TEST_LOOK_FOR_H
 
+#include <type_traits>
+
 #include "conceptrodon/metafunctions/mouldivore/look_for.hpp"
 #include "conceptrodon/utilities/shuttle.hpp"
 #include "conceptrodon/metafunctions/typelivore/is_same_as.hpp"
@@ -69,6 +71,42 @@ SAME_TYPE(Shuttle<SHEEP_SPROUT(80)>);
 
 
 
+/******************************************************************************************************/
+/**** IsInt ****/
+// Fails to compile once instantiated with `Poison`.
+struct Poison;
+
+template<typename Element>
+struct IsInt
+{
+    static_assert(not std::is_same_v<Element, Poison>, "Poison should not be examined.");
+    static constexpr bool value {std::is_same_v<Element, int>};
+};
+
+// The blocks after the first match are not examined.
+static_assert
+(
+    LookFor<IsInt>::Mold_v
+    <
+        int*, int, int*, int*, int*, int*, int*, int*,
+        int*, int*, int*, int*, int*, int*, int*, int*,
+        Poison
+    > == 1
+);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// An empty list contains no match.
+static_assert(LookFor<IsInt>::Mold<>::value == -1);
+static_assert(LookFor<IsInt>::Mold_v<> == -1);
+/******************************************************************************************************/
+
+
+
+
 }}}}
 
 #include "macaron/fragmental/amenity/undef_alkane.hpp"
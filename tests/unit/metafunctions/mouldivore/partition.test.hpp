@@ -0,0 +1,79 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_PARTITION_H
+#define CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_PARTITION_H
+
+#include <type_traits>
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/metafunctions/mouldivore/partition.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace UnitTests {
+namespace TestPartition {
+
+
+
+
+/******************************************************************************************************/
+template<typename Element>
+struct IsPointer
+{ static constexpr bool value {std::is_pointer_v<Element>}; };
+
+template<typename Element>
+struct IsConst
+{ static constexpr bool value {std::is_const_v<std::remove_pointer_t<Element>>}; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int*, int const*, double*>, Capsule<int, char>>
+
+SAME_TYPE(Partition<IsPointer>::Mold<int, int*, char, int const*, double*>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int const*>, Capsule<int, int*, char, double*>>
+
+SAME_TYPE(Partition<IsPointer, IsConst>::Mold<int, int*, char, int const*, double*>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<>, Capsule<int, char>>
+
+SAME_TYPE(Partition<IsPointer>::Mold<int, char>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<>, Capsule<>>
+
+SAME_TYPE(Partition<IsPointer>::Mold<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
@@ -0,0 +1,223 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_STREAMLINE_H
+#define CONCEPTRODON_MOULDIVORE_UNIT_TESTS_TEST_STREAMLINE_H
+
+#include <tuple>
+#include <type_traits>
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/moy.hpp"
+#include "conceptrodon/metafunctions/mouldivore/streamline.hpp"
+#include "conceptrodon/metafunctions/mouldivore/cognate_reverse.hpp"
+#include "conceptrodon/metafunctions/mouldivore/cognate_transform.hpp"
+#include "conceptrodon/metafunctions/mouldivore/conceal.hpp"
+#include "conceptrodon/metafunctions/mouldivore/reveal.hpp"
+#include "conceptrodon/metafunctions/mouldivore/repack.hpp"
+#include "conceptrodon/metafunctions/cotanivore/typical_paste.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Mouldivore {
+namespace UnitTests {
+namespace TestStreamline {
+
+
+
+
+/******************************************************************************************************/
+template<typename Element>
+struct IsInt
+: public std::is_same<Element, int> {};
+
+template<typename Element>
+struct IsPointer
+: public std::is_pointer<Element> {};
+
+template<typename Element>
+using AddPointer = Element*;
+
+template<typename...Elements>
+struct Operation
+{ using type = std::tuple<Elements...>; };
+
+template<typename...Elements>
+using Pad = std::tuple<Elements..., int>;
+
+template<typename...Elements>
+using DropVoid = Cotanivore::TypicalPaste
+<
+    Capsule<>,
+    std::conditional_t<std::is_void_v<Elements>, Capsule<>, Capsule<Elements>>...
+>::type;
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<Moy<Capsule>>
+
+SAME_TYPE(Streamline<CognateReverse<std::tuple>, CognateReverse<Capsule>>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Capsule<int, char>
+
+SAME_TYPE(Streamline<CognateReverse<std::tuple>, CognateReverse<Capsule>>::Mold<int, char>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<CognateReverse<Capsule>>
+
+SAME_TYPE
+(
+    Streamline
+    <
+        CognateReverse<std::tuple>,
+        CognateReverse<Capsule>,
+        CognateReverse<Capsule>
+    >
+    ::type
+);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Capsule<char, int>
+
+SAME_TYPE
+(
+    Streamline
+    <
+        CognateReverse<std::tuple>,
+        Conceal<Operation>,
+        CognateReverse<Capsule>,
+        CognateReverse<Capsule>
+    >
+    ::Mold<int, char>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<Reveal<Operation>>
+
+SAME_TYPE(Streamline<Conceal<Operation>, Reveal<Operation>>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    std::tuple<int, char>
+
+SAME_TYPE(Streamline<Conceal<Operation>, Reveal<Operation>>::Mold<int, char>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<Repack<Capsule>>
+
+SAME_TYPE(Streamline<Repack<std::tuple>, Moy<Capsule>>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Capsule<int, char>
+
+SAME_TYPE(Streamline<Repack<std::tuple>, Moy<Capsule>>::Mold<std::tuple<int>, Capsule<char>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+using Fused = Streamline
+<
+    CognateTransform<std::tuple>::Road<IsInt>::Road<AddPointer>,
+    CognateTransform<std::tuple>::Road<IsPointer>::Road<AddPointer>,
+    Moy<Capsule>
+>;
+
+static_assert(Fused::type::size() == 1);
+
+#define SUPPOSED_TYPE \
+    Capsule<int**, char>
+
+SAME_TYPE(Fused::Mold<int, char>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// `Pad` appends `int` to its arguments.
+// Its result does not unpack back into the arguments, so the reversals are kept.
+static_assert(Streamline<CognateReverse<Pad>, CognateReverse<Capsule>>::type::size() == 2);
+
+#define SUPPOSED_TYPE \
+    Capsule<int, char>
+
+SAME_TYPE(Streamline<CognateReverse<Pad>, CognateReverse<Capsule>>::Mold<char>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// `DropVoid` is an alias that keeps its arguments unless they are `void`.
+// Aliases are not faithful, so the steps are kept.
+static_assert(Streamline<Moy<DropVoid>, Moy<std::tuple>>::type::size() == 2);
+
+#define SUPPOSED_TYPE \
+    std::tuple<int>
+
+SAME_TYPE(Streamline<Moy<DropVoid>, Moy<std::tuple>>::Mold<int, void>);
+
+#undef SUPPOSED_TYPE
+
+static_assert(Streamline<CognateReverse<DropVoid>, CognateReverse<Capsule>>::type::size() == 2);
+
+#define SUPPOSED_TYPE \
+    Capsule<int, char>
+
+SAME_TYPE(Streamline<CognateReverse<DropVoid>, CognateReverse<Capsule>>::Mold<int, void, char>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
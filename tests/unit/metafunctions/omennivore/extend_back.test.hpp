@@ -101,6 +101,19 @@ SAME_TYPE(ExtendBack<Shuttle<0>>::Page<1>);
 
 
 
+/******************************************************************************************************/
+// New variables are cast to the type of the sequence.
+#define SUPPOSED_TYPE   \
+    std::integer_sequence<int, 0, 1>
+
+SAME_TYPE(ExtendBack<std::integer_sequence<int, 0>>::Page<1u>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
 /******************************************************************************************************/
 #define SUPPOSED_TYPE   \
     Vehicle<Vessel_0, Capsule>
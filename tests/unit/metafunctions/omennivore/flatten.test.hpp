@@ -0,0 +1,130 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_FLATTEN_H
+#define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_FLATTEN_H
+
+#include <tuple>
+#include <utility>
+
+#include "conceptrodon/metafunctions/omennivore/flatten.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vehicle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+namespace UnitTests {
+namespace TestFlatten {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<int, int*, int**, int***>
+
+SAME_TYPE(Flatten<Capsule<Capsule<int, int*>, int**, Capsule<Capsule<int***>>>>);
+SAME_TYPE(Flatten<Capsule<Capsule<int, int*>, int**, Capsule<Capsule<int***>>>, 2>);
+SAME_TYPE(Flatten<Capsule<Capsule<>, int, Capsule<int*, Capsule<int**, Capsule<int***>>>>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<int, int*, int**, Capsule<int***>>
+
+SAME_TYPE(Flatten<Capsule<Capsule<int, int*>, int**, Capsule<Capsule<int***>>>, 1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, int*>, int**, Capsule<Capsule<int***>>>
+
+SAME_TYPE(Flatten<Capsule<Capsule<int, int*>, int**, Capsule<Capsule<int***>>>, 0>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    std::tuple<int, Capsule<int*>, int**>
+
+SAME_TYPE(Flatten<std::tuple<std::tuple<int>, Capsule<int*>, std::tuple<>, std::tuple<std::tuple<int**>>>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(Flatten<Capsule<>>);
+SAME_TYPE(Flatten<Capsule<Capsule<>, Capsule<Capsule<>>>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 2, 3>
+
+SAME_TYPE(Flatten<Shuttle<1, 2, 3>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    std::index_sequence<1, 2, 3>
+
+SAME_TYPE(Flatten<std::index_sequence<1, 2, 3>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Vehicle<Capsule, std::tuple>
+
+SAME_TYPE(Flatten<Vehicle<Capsule, std::tuple>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
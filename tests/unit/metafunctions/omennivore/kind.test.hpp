@@ -0,0 +1,203 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_KIND_H
+#define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_KIND_H
+
+#include <utility>
+#include <tuple>
+
+#include "conceptrodon/metafunctions/omennivore/kind.hpp"
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/utilities/vehicle.hpp"
+#include "conceptrodon/utilities/carrier.hpp"
+#include "conceptrodon/utilities/reverie.hpp"
+#include "conceptrodon/utilities/phantom.hpp"
+#include "conceptrodon/utilities/forlorn.hpp"
+#include "conceptrodon/utilities/travail.hpp"
+#include "conceptrodon/utilities/lullaby.hpp"
+#include "conceptrodon/utilities/halcyon.hpp"
+#include "conceptrodon/utilities/pursuit.hpp"
+#include "conceptrodon/utilities/persist.hpp"
+#include "conceptrodon/utilities/sunrise.hpp"
+#include "conceptrodon/utilities/morning.hpp"
+#include "conceptrodon/metafunctions/varybivore/range.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+namespace UnitTests {
+namespace TestKind {
+
+
+
+
+/******************************************************************************************************/
+static_assert(Kind<int>::value == Kinds::Unknown);
+static_assert(Kind<std::tuple<int, int*>>::value == Kinds::Mold);
+static_assert(Kind<Shuttle<0, 1>>::value == Kinds::Page);
+static_assert(Kind<std::index_sequence<0, 1>>::value == Kinds::TypedPage);
+static_assert(Kind<Vehicle<Capsule>>::value == Kinds::Road);
+static_assert(Kind<Carrier<Shuttle>>::value == Kinds::Rail);
+static_assert(Kind<Reverie<Vehicle>>::value == Kinds::Flow);
+static_assert(Kind<Phantom<Carrier>>::value == Kinds::Sail);
+static_assert(Kind<Forlorn<Reverie>>::value == Kinds::Snow);
+static_assert(Kind<Travail<Phantom>>::value == Kinds::Hail);
+static_assert(Kind<Lullaby<Forlorn>>::value == Kinds::Cool);
+static_assert(Kind<Halcyon<Travail>>::value == Kinds::Calm);
+static_assert(Kind<Pursuit<Lullaby>>::value == Kinds::Grit);
+static_assert(Kind<Persist<Halcyon>>::value == Kinds::Will);
+static_assert(Kind<Sunrise<Pursuit>>::value == Kinds::Glow);
+static_assert(Kind<Morning<Persist>>::value == Kinds::Dawn);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    3
+
+EQUAL_VALUE(Kind<std::tuple<int, int*, int**>>::size);
+EQUAL_VALUE(Kind<std::index_sequence<0, 1, 2>>::size);
+EQUAL_VALUE(Kind<Reverie<Vehicle, Vehicle, Vehicle>>::size);
+EQUAL_VALUE(Kind<Morning<Persist, Persist, Persist>>::size);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE  \
+    Capsule<int, int*>
+
+SAME_TYPE(Kind<std::tuple<int, int*>>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    Shuttle<0, 1>
+
+SAME_TYPE(Kind<std::integer_sequence<int, 0, 1>>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    Vehicle<Capsule, Capsule>
+
+SAME_TYPE(Kind<Vehicle<Capsule, Capsule>>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+struct Operation
+{
+    template<typename...Elements>
+    using Mold = Capsule<Elements...>;
+
+    template<auto...Variables>
+    using Page = Shuttle<Variables...>;
+};
+
+#define SUPPOSED_TYPE  \
+    Capsule<int, int*>
+
+SAME_TYPE(Kind<std::tuple<int, int*>>::Relay<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    Shuttle<0, 1>
+
+SAME_TYPE(Kind<std::integer_sequence<int, 0, 1>>::Relay<Operation>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE  \
+    std::tuple<int*, int**>
+
+SAME_TYPE(Kind<std::tuple<int>>::Mold<int*, int**>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    std::index_sequence<2, 3>
+
+SAME_TYPE(Kind<std::index_sequence<0>>::Page<2, 3>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+/******************************************************************************************************/
+// A `Range` is expanded into its variables rather than its template arguments.
+template<auto Variable>
+struct Twice
+{ static constexpr auto value {Variable * 2}; };
+
+static_assert(Kind<Varybivore::Range<0, 10, 3>>::value == Kinds::Page);
+static_assert(Kind<Varybivore::Range<0, 10, 3>::TurnOver>::value == Kinds::Page);
+static_assert(Kind<Varybivore::Range<0, 10, 3>::Erase<1>>::value == Kinds::Page);
+
+#define SUPPOSED_VALUE  \
+    4
+
+EQUAL_VALUE(Kind<Varybivore::Range<0, 10, 3>>::size);
+EQUAL_VALUE(Kind<Varybivore::Range<0, 10, 3>::TurnOver>::size);
+EQUAL_VALUE(Kind<Varybivore::Range<0, 10, 3>::Gauge<Twice>>::size);
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_TYPE  \
+    Shuttle<0, 3, 6, 9>
+
+SAME_TYPE(Kind<Varybivore::Range<0, 10, 3>>::type);
+SAME_TYPE(Kind<Varybivore::Range<0, 10, 3>>::Relay<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    Shuttle<9, 6, 3, 0>
+
+SAME_TYPE(Kind<Varybivore::Range<0, 10, 3>::TurnOver>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    Shuttle<3, 9>
+
+SAME_TYPE(Kind<Varybivore::Range<0, 10, 3>::Slice<1>::Erase<1>>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE  \
+    Shuttle<0, 1, 2, 7>
+
+SAME_TYPE(Kind<Varybivore::Range<0, 3>>::Page<0, 1, 2, 7>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
@@ -4,6 +4,8 @@
 #ifndef CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_PRESS_H
 #define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_PRESS_H
 
+#include <utility>
+
 #include "conceptrodon/metafunctions/omennivore/press.hpp"
 
 #include "conceptrodon/utilities/capsule.hpp"
@@ -178,6 +180,19 @@ VALID
 VALID(Press<Operation>::Mold<Capsule<>, Capsule<std::true_type>>::value);
 INVALID(Press<Operation>::Mold<Capsule<>, Capsule<>>::value);
 
+// Typed sequences pass their variables to `Page`.
+struct Summation
+{
+    template<auto...Variables>
+    struct ProtoPage
+    { static constexpr auto value {(0 + ... + Variables)}; };
+
+    template<auto...Agreements>
+    using Page = ProtoPage<Agreements...>;
+};
+
+VALID(Press<Summation>::Mold<std::integer_sequence<int, 1, 2, 3>>::value == 6);
+
 }}}}
 
 #include "macaron/judgmental/amenity/undef_valid.hpp"
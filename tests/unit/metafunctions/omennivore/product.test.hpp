@@ -0,0 +1,138 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_PRODUCT_H
+#define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_PRODUCT_H
+
+#include <utility>
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/omennivore/product.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+namespace UnitTests {
+namespace TestProduct {
+
+
+
+
+/******************************************************************************************************/
+template<typename...>
+struct Operation {};
+
+template<auto...>
+struct ValueOperation {};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule         \
+    <               \
+        Operation<int, void, int*>,      \
+        Operation<int, void, int**>,     \
+        Operation<int, void*, int*>,     \
+        Operation<int, void*, int**>,    \
+        Operation<int, void**, int*>,    \
+        Operation<int, void**, int**>,   \
+        Operation<char, void, int*>,     \
+        Operation<char, void, int**>,    \
+        Operation<char, void*, int*>,    \
+        Operation<char, void*, int**>,   \
+        Operation<char, void**, int*>,   \
+        Operation<char, void**, int**>   \
+    >
+
+SAME_TYPE
+(
+    Product<Capsule<int, char>, Capsule<void, void*, void**>, Capsule<int*, int**>>
+    ::Road<Operation>
+    ::Road<Capsule>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Operation<char, void*, int**>
+
+SAME_TYPE
+(
+    Product<Capsule<int, char>, Capsule<void, void*, void**>, Capsule<int*, int**>>
+    ::Road<Operation>
+    ::Page<9>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule         \
+    <               \
+        ValueOperation<1, size_t{3}>,    \
+        ValueOperation<1, size_t{4}>,    \
+        ValueOperation<2, size_t{3}>,    \
+        ValueOperation<2, size_t{4}>     \
+    >
+
+SAME_TYPE
+(
+    Product<Shuttle<1, 2>, std::index_sequence<3, 4>>
+    ::Rail<ValueOperation>
+    ::Road<Capsule>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<>
+
+SAME_TYPE(Product<Capsule<int, char>, Capsule<>>::Road<Operation>::Road<Capsule>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    12
+
+EQUAL_VALUE(Product<Capsule<int, char>, Shuttle<1, 2, 3>, std::make_index_sequence<2>>::value);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
@@ -5,6 +5,8 @@
 #define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_SEND_H
 
 #include <concepts>
+#include <tuple>
+#include <utility>
 
 #include "conceptrodon/metafunctions/omennivore/send.hpp"
 
@@ -22,6 +24,7 @@
 #include "conceptrodon/utilities/persist.hpp"
 #include "conceptrodon/utilities/sunrise.hpp"
 #include "conceptrodon/utilities/morning.hpp"
+#include "conceptrodon/metafunctions/varybivore/range.hpp"
 
 #include "macaron/judgmental/same_type.hpp"
 
@@ -150,6 +153,38 @@ SAME_TYPE(Send<Shuttle<0, 0>>::UniRail<Operation_1>);
 
 
 
+/******************************************************************************************************/
+// Typed sequences only send their variables.
+#define SUPPOSED_TYPE   \
+    Operation_1<1, 2>
+
+SAME_TYPE(Send<std::integer_sequence<int, 1, 2>>::Rail<Operation_1>);
+SAME_TYPE(Send<std::integer_sequence<int, 1, 2>>::UniRail<Operation_1>);
+
+#undef SUPPOSED_TYPE
+
+// A `Range` sends its variables, not its bounds.
+#define SUPPOSED_TYPE   \
+    Operation_1<0, 3>
+
+SAME_TYPE(Send<Varybivore::Range<0, 5, 3>>::UniRail<Operation_1>);
+SAME_TYPE(Send<Varybivore::Range<3, -1, -3>::TurnOver>::UniRail<Operation_1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// `Send` exposes the members of the vessel holding the items.
+static_assert(Send<std::tuple<int, int*, int**>>::size() == 3);
+static_assert(Send<std::integer_sequence<int, 1, 2>>::size() == 2);
+/******************************************************************************************************/
+
+
+
+
 /******************************************************************************************************/
 #define SUPPOSED_TYPE   \
     Operation_2<Capsule, Capsule>
@@ -22,6 +22,7 @@
 #include "conceptrodon/utilities/persist.hpp"
 #include "conceptrodon/utilities/sunrise.hpp"
 #include "conceptrodon/utilities/morning.hpp"
+#include "conceptrodon/metafunctions/varybivore/range.hpp"
 
 #include "macaron/judgmental/equal_value.hpp"
 
@@ -53,6 +54,8 @@ struct DawnVessel {};
 EQUAL_VALUE(Total<Capsule<int, int*, int**, int***>>::value);
 EQUAL_VALUE(Total<Shuttle<0, 1, 2, 3>>::value);
 EQUAL_VALUE(Total<std::index_sequence<0, 1, 2, 3>>::value);
+EQUAL_VALUE(Total<Varybivore::Range<0, 10, 3>>::value);
+EQUAL_VALUE(Total<Varybivore::Range<10u, 0u, -3>::TurnOver>::value);
 EQUAL_VALUE(Total<Vehicle<Capsule, Capsule, Capsule, Capsule>>::value);
 EQUAL_VALUE(Total<Carrier<Shuttle, Shuttle, Shuttle, Shuttle>>::value);
 EQUAL_VALUE(Total<Reverie<Vehicle, Vehicle, Vehicle, Vehicle>>::value);
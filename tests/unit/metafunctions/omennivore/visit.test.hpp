@@ -0,0 +1,89 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_VISIT_H
+#define CONCEPTRODON_OMENNIVORE_UNIT_TESTS_TEST_VISIT_H
+
+#include <variant>
+
+#include "conceptrodon/metafunctions/omennivore/visit.hpp"
+
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Omennivore {
+namespace UnitTests {
+namespace TestVisit {
+
+
+
+
+/******************************************************************************************************/
+struct Visitor
+{
+    constexpr int operator()(int, float) const { return 0; }
+    constexpr int operator()(int, double) const { return 1; }
+    constexpr int operator()(int, int*) const { return 2; }
+    constexpr int operator()(char, float) const { return 3; }
+    constexpr int operator()(char, double) const { return 4; }
+    constexpr int operator()(char, int*) const { return 5; }
+};
+
+using Variant_0 = std::variant<int, char>;
+using Variant_1 = std::variant<float, double, int*>;
+
+using Metafunction = Visit<Variant_0 const&, Variant_1 const&>
+::Mold<Visitor const&>;
+
+constexpr Variant_0 variant_0 {'c'};
+constexpr Variant_1 variant_1 {1.0};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    6
+
+EQUAL_VALUE(Metafunction::value.size());
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    4
+
+EQUAL_VALUE(Metafunction::index(variant_0, variant_1));
+EQUAL_VALUE(Metafunction::visit(Visitor{}, variant_0, variant_1));
+EQUAL_VALUE(Metafunction::value[4](Visitor{}, variant_0, variant_1));
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    2
+
+EQUAL_VALUE(Metafunction::visit(Visitor{}, Variant_0{1}, Variant_1{nullptr}));
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
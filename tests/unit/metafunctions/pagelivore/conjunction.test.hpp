@@ -77,6 +77,23 @@ VALID(Conjunction<>::Page<1, 2, 3>::value);
 
 
 
+/******************************************************************************************************/
+/**** Poisoned ****/
+// Fails to compile once instantiated.
+template<auto...Variables>
+struct Poisoned
+{
+    static_assert(sizeof...(Variables) == 0, "Poisoned should not be instantiated.");
+    static constexpr bool value {true};
+};
+
+// The predicates after the first failed one are not instantiated.
+INVALID(Conjunction<Pred_0, Pred_1, Poisoned>::Page<-2>::value);
+/******************************************************************************************************/
+
+
+
+
 }}}}
 
 #include "macaron/judgmental/amenity/undef_valid.hpp"
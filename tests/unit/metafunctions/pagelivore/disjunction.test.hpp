@@ -77,6 +77,23 @@ INVALID(Disjunction<>::Page<1, 2, 3>::value);
 
 
 
+/******************************************************************************************************/
+/**** Poisoned ****/
+// Fails to compile once instantiated.
+template<auto...Variables>
+struct Poisoned
+{
+    static_assert(sizeof...(Variables) == 0, "Poisoned should not be instantiated.");
+    static constexpr bool value {true};
+};
+
+// The predicates after the first satisfied one are not instantiated.
+VALID(Disjunction<Pred_0, Poisoned>::Page<11>::value);
+/******************************************************************************************************/
+
+
+
+
 }}}}
 
 #include "macaron/judgmental/amenity/undef_valid.hpp"
@@ -0,0 +1,98 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_PAGELIVORE_UNIT_TESTS_TEST_FIND_ALL_H
+#define CONCEPTRODON_PAGELIVORE_UNIT_TESTS_TEST_FIND_ALL_H
+
+#include <cstddef>
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/pagelivore/find_all.hpp"
+#include "conceptrodon/metafunctions/varybivore/gather.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Pagelivore {
+namespace UnitTests {
+namespace TestFindAll {
+
+
+
+
+/******************************************************************************************************/
+template<auto...>
+struct Operation;
+
+template<auto Variable>
+struct IsEven
+{ static constexpr bool value {Variable % 2 == 0}; };
+
+template<auto Variable>
+struct IsPositive
+{ static constexpr bool value {0 < Variable}; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{0}, size_t{2}, size_t{3}>
+
+SAME_TYPE(FindAll<IsEven>::Page<-2, 1, 4, 6, 7>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{2}, size_t{3}>
+
+SAME_TYPE(FindAll<IsEven, IsPositive>::Page<-2, 1, 4, 6, 7>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(FindAll<IsEven>::Page<1, 3>);
+SAME_TYPE(FindAll<IsEven>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+static_assert(FindAll<IsEven>::Page_v<-2, 1, 4, 6, 7>.size() == 3);
+static_assert(FindAll<IsEven>::Page_v<-2, 1, 4, 6, 7>[2] == 3);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// The indices can be handed to `Gather` to extract the matches.
+#define SUPPOSED_TYPE   \
+    Operation<-2, 4, 6>
+
+SAME_TYPE
+(
+    FindAll<IsEven>::Page<-2, 1, 4, 6, 7>
+    ::Rail<Varybivore::Gather<-2, 1, 4, 6, 7>::Page>
+    ::Rail<Operation>
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
@@ -70,6 +70,40 @@ SAME_TYPE(Shuttle<SHEEP_SPROUT(40)>);
 
 
 
+/******************************************************************************************************/
+/**** IsTwo ****/
+// Fails to compile once instantiated with `-1`.
+template<auto Variable>
+struct IsTwo
+{
+    static_assert(Variable != -1, "-1 should not be examined.");
+    static constexpr bool value {Variable == 2};
+};
+
+// The blocks after the first match are not examined.
+static_assert
+(
+    LookFor<IsTwo>::Page_v
+    <
+        0, 2, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        -1
+    > == 1
+);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// An empty list contains no match.
+static_assert(LookFor<IsTwo>::Page<>::value == -1);
+static_assert(LookFor<IsTwo>::Page_v<> == -1);
+/******************************************************************************************************/
+
+
+
+
 }}}}
 
 #include "macaron/fragmental/amenity/undef_alkane.hpp"
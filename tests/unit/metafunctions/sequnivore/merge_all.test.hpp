@@ -0,0 +1,85 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_SEQUNIVORE_UNIT_TESTS_TEST_MERGE_ALL_H
+#define CONCEPTRODON_SEQUNIVORE_UNIT_TESTS_TEST_MERGE_ALL_H
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/sequnivore/merge_all.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Sequnivore {
+namespace UnitTests {
+namespace TestMergeAll {
+
+
+
+
+/******************************************************************************************************/
+template<auto...>
+struct Sequence {};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<0, 1, 2, 3, 4, 5, 6>
+
+SAME_TYPE(MergeAll<Shuttle<1, 4>, Sequence<2, 5>, Shuttle<>, Shuttle<0, 3, 6>>);
+SAME_TYPE(MergeAll<Shuttle<0, 1, 2, 3, 4, 5, 6>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<'a', 'b', 'b', 'c'>
+
+SAME_TYPE(MergeAll<Shuttle<'b', 'c'>, Shuttle<'a', 'b'>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(MergeAll<>);
+SAME_TYPE(MergeAll<Shuttle<>, Sequence<>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types are merged in their common type.
+#define SUPPOSED_TYPE   \
+    Shuttle<-2l, 1l, 3l>
+
+SAME_TYPE(MergeAll<Shuttle<1>, Sequence<-2l>, Shuttle<3u>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
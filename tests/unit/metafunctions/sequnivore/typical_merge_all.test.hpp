@@ -0,0 +1,72 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_SEQUNIVORE_UNIT_TESTS_TEST_TYPICAL_MERGE_ALL_H
+#define CONCEPTRODON_SEQUNIVORE_UNIT_TESTS_TEST_TYPICAL_MERGE_ALL_H
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/sequnivore/typical_merge_all.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Sequnivore {
+namespace UnitTests {
+namespace TestTypicalMergeAll {
+
+
+
+
+/******************************************************************************************************/
+template<auto...>
+struct Sequence {};
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<0, 1, 2, 3, 4, 5, 6>
+
+SAME_TYPE(TypicalMergeAll<Shuttle<1, 4>, Sequence<2, 5>, Shuttle<>, Shuttle<0, 3, 6>>::type);
+SAME_TYPE(TypicalMergeAll<Shuttle<0, 1, 2, 3, 4, 5, 6>>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<'a', 'b', 'b', 'c'>
+
+SAME_TYPE(TypicalMergeAll<Shuttle<'b', 'c'>, Shuttle<'a', 'b'>>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(TypicalMergeAll<>::type);
+SAME_TYPE(TypicalMergeAll<Shuttle<>, Sequence<>>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_CANONICAL_CONTAINS_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_CANONICAL_CONTAINS_H
+
+#include "conceptrodon/metafunctions/typelivore/canonical_contains.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/judgmental/invalid.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/judgmental/amenity/define_invalid.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestCanonicalContains {
+
+
+
+
+/******************************************************************************************************/
+VALID(CanonicalContains<int, int*, void, int>::Mold<int>::value);
+VALID(CanonicalContains<int, int*, void, int>::Mold_v<int*>);
+VALID(CanonicalContains<int, int*, void, int>::Mold_v<void>);
+INVALID(CanonicalContains<int, int*, void, int>::Mold_v<int**>);
+INVALID(CanonicalContains<int, int*, void, int>::Mold_v<int const>);
+INVALID(CanonicalContains<>::Mold_v<int>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep.hpp"
+VALID(CanonicalContains<SHEEP_SPROUT(240)>::Mold_v<std::integral_constant<int, 0>>);
+VALID(CanonicalContains<SHEEP_SPROUT(240)>::Mold_v<std::integral_constant<int, 239>>);
+INVALID(CanonicalContains<SHEEP_SPROUT(240)>::Mold_v<std::integral_constant<int, 240>>);
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/judgmental/amenity/undef_invalid.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
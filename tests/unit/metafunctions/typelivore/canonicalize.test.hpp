@@ -0,0 +1,97 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_CANONICALIZE_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_CANONICALIZE_H
+
+#include "conceptrodon/metafunctions/typelivore/canonicalize.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/judgmental/equal_value.hpp"
+#include "macaron/fragmental/sheep.hpp"
+#include "macaron/fragmental/sheep_reversed.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+#include "macaron/fragmental/amenity/define_sheep_reversed.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestCanonicalize {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Canonicalize<int, int*, void, int**>::Road<Capsule>
+
+SAME_TYPE(Canonicalize<int**, void, int*, int>::Road<Capsule>);
+SAME_TYPE(Canonicalize<void, int, int, int**, void, int*>::UniRoad<Capsule>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<>
+
+SAME_TYPE(Canonicalize<>::Road<Capsule>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    240
+
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep.hpp"
+EQUAL_VALUE(Canonicalize<SHEEP_SPROUT(240), SHEEP_SPROUT(240)>::Road<Capsule>::size());
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep.hpp"
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep.hpp"
+using SupposedResult = Canonicalize<SHEEP_SPROUT(240)>::Road<Capsule>;
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep_reversed.hpp"
+SAME_TYPE(Canonicalize<SHEEP_REVERSED_SPROUT(240)>::Road<Capsule>);
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep_reversed.hpp"
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+#include "macaron/fragmental/amenity/undef_sheep_reversed.hpp"
+
+#endif
@@ -0,0 +1,87 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_CHUNK_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_CHUNK_H
+
+#include "conceptrodon/metafunctions/typelivore/chunk.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestChunk {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, int*>, Capsule<int**, int***>, Capsule<int****>>
+
+SAME_TYPE(Chunk<int, int*, int**, int***, int****>::Page<2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, void>, Capsule<int[2], int()>>
+
+SAME_TYPE(Chunk<int, void, int[2], int()>::Page<2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int>, Capsule<int>, Capsule<int*>>
+
+SAME_TYPE(Chunk<int, int, int*>::Page<1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, int*, int**>>
+
+SAME_TYPE(Chunk<int, int*, int**>::Page<3>);
+SAME_TYPE(Chunk<int, int*, int**>::Page<5>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(Chunk<>::Page<2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
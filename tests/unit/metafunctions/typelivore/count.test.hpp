@@ -0,0 +1,58 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_COUNT_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_COUNT_H
+
+#include "conceptrodon/metafunctions/typelivore/count.hpp"
+
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestCount {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    3
+
+EQUAL_VALUE(Count<int, float, int, char, float, int>::Mold_v<int>);
+EQUAL_VALUE(Count<int, float, int, char, float, int>::Mold<int>::value);
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE  \
+    2
+
+EQUAL_VALUE(Count<int, float, int, char, float, int>::Mold_v<float>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    0
+
+EQUAL_VALUE(Count<int, float, int, char, float, int>::Mold_v<int const>);
+EQUAL_VALUE(Count<>::Mold_v<int>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
\ No newline at end of file
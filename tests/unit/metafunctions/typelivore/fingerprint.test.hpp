@@ -0,0 +1,47 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_FINGERPRINT_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_FINGERPRINT_H
+
+#include "conceptrodon/metafunctions/typelivore/fingerprint.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/judgmental/invalid.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/judgmental/amenity/define_invalid.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestFingerprint {
+
+
+
+
+/******************************************************************************************************/
+VALID(Fingerprint<int>::value == Fingerprint_v<int>);
+VALID(Fingerprint<void>::value == Fingerprint_v<void>);
+VALID(Fingerprint<int const&>::value == Fingerprint_v<int const&>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+INVALID(Fingerprint<int>::value == Fingerprint<int*>::value);
+INVALID(Fingerprint<int>::value == Fingerprint<int const>::value);
+INVALID(Fingerprint<int&>::value == Fingerprint<int&&>::value);
+INVALID(Fingerprint<void>::value == Fingerprint<void*>::value);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/judgmental/amenity/undef_invalid.hpp"
+
+#endif
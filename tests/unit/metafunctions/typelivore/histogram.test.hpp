@@ -0,0 +1,66 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_HISTOGRAM_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_HISTOGRAM_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/typelivore/histogram.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestHistogram {
+
+
+
+
+/******************************************************************************************************/
+// Distinct elements appear in the order they first appear.
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, float, char>, Shuttle<size_t{3}, size_t{2}, size_t{1}>>
+
+SAME_TYPE(Histogram<int, float, int, char, float, int>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<int, int*, int const>
+
+SAME_TYPE(Histogram<int, int*, int const, int*>::Distinct);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{1}, size_t{2}, size_t{1}>
+
+SAME_TYPE(Histogram<int, int*, int const, int*>::Counts);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<>, Shuttle<>>
+
+SAME_TYPE(Histogram<>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
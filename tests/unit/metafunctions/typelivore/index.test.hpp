@@ -0,0 +1,97 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_INDEX_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_INDEX_H
+
+#include <type_traits>
+#include "conceptrodon/metafunctions/typelivore/index.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestIndex {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    int*
+
+SAME_TYPE(Index<int, int*, int**>::Page<1>);
+SAME_TYPE(Index<int, int*, int**>::Expect<1>::Page<1>);
+SAME_TYPE(Index<int, int*, int**>::Expect<100>::Page<1>);
+SAME_TYPE(Index<int, int*, int**>::Foresee<1, 1>);
+SAME_TYPE(Index<int, int*, int**>::Foresee<100, 1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep.hpp"
+using SupposedResult = Capsule<SHEEP_SPROUT(240)>;
+
+template<size_t I>
+using Single = Index<SHEEP_SPROUT(240)>::Page<I>;
+
+template<size_t I>
+using Repeated = Index<SHEEP_SPROUT(240)>::Expect<240>::Page<I>;
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+#define SHEEP_PREFIX    \
+    Single<
+#define SHEEP_SUFFIX    \
+    >
+#define SHEEP_SEPARATOR \
+    ,
+
+SAME_TYPE(Capsule<SHEEP_SPROUT(240)>);
+
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+
+#define SHEEP_PREFIX    \
+    Repeated<
+#define SHEEP_SUFFIX    \
+    >
+#define SHEEP_SEPARATOR \
+    ,
+
+SAME_TYPE(Capsule<SHEEP_SPROUT(240)>);
+
+#undef SHEEP_PREFIX
+#undef SHEEP_SUFFIX
+#undef SHEEP_SEPARATOR
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
@@ -0,0 +1,87 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_INTERSECTION_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_INTERSECTION_H
+
+#include "conceptrodon/metafunctions/typelivore/intersection.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestIntersection {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<int*, void>
+
+SAME_TYPE(Intersection<int, int*, void>::Mold<void, int**, int*>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<>
+
+SAME_TYPE(Intersection<int, void>::Mold<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<>
+
+SAME_TYPE(Intersection<>::Mold<int, void>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep.hpp"
+using SupposedResult = Capsule<SHEEP_SPROUT(240)>;
+using Result = Intersection<SHEEP_SPROUT(480)>::Mold<SHEEP_SPROUT(240)>;
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+SAME_TYPE(Result);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
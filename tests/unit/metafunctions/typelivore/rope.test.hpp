@@ -0,0 +1,133 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_ROPE_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_ROPE_H
+
+#include <tuple>
+
+#include "conceptrodon/metafunctions/typelivore/rope.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestRope {
+
+
+
+
+/******************************************************************************************************/
+template<typename...>
+struct Operation;
+
+template<size_t>
+struct Element;
+
+template<typename Origin, size_t N>
+struct Append
+{ using type = Append<typename Origin::template Paste<Rope<Element<N>>>, N - 1>::type; };
+
+template<typename Origin>
+struct Append<Origin, 0>
+{ using type = Origin; };
+
+template<typename Origin, size_t N>
+struct Prepend
+{ using type = Prepend<typename Rope<Element<N>>::template Paste<Origin>, N - 1>::type; };
+
+template<typename Origin>
+struct Prepend<Origin, 0>
+{ using type = Origin; };
+
+using Appended = Append<Rope<>, 500>::type;
+using Prepended = Prepend<Rope<>, 500>::type;
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Operation<int, int*, int**, int***>
+
+SAME_TYPE(Rope<int, int*>::Paste<Rope<int**>, Rope<int***>>::Road<Operation>);
+SAME_TYPE(Rope<int>::Paste<Rope<>, Rope<int*, int**>, Rope<int***>>::UniRoad<Operation>);
+SAME_TYPE(Rope<>::Paste<Rope<int, int*, int**, int***>>::Road<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    std::tuple<int, int*>
+
+SAME_TYPE(Rope<int, int*>::UniRoad<std::tuple>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Rope<int, int*>
+
+SAME_TYPE(Rope<>::Paste<Rope<int, int*>>);
+SAME_TYPE(Rope<int, int*>::Paste<Rope<>>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    int**
+
+SAME_TYPE(Rope<int, int*>::Paste<Rope<int**>, Rope<int***>>::Among<2>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Element<500>
+
+SAME_TYPE(Appended::Among<0>);
+SAME_TYPE(Prepended::Among<499>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Element<1>
+
+SAME_TYPE(Appended::Among<499>);
+SAME_TYPE(Prepended::Among<0>);
+SAME_TYPE(Appended::Paste<Prepended>::Among<500>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    500
+
+EQUAL_VALUE(Appended::size());
+EQUAL_VALUE(Prepended::size());
+EQUAL_VALUE(Appended::Road<Capsule>::size());
+
+#undef SUPPOSED_VALUE
+
+static_assert(Appended::height <= 20);
+static_assert(Prepended::height <= 20);
+/******************************************************************************************************/
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
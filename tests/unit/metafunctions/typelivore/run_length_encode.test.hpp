@@ -0,0 +1,66 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_RUN_LENGTH_ENCODE_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_RUN_LENGTH_ENCODE_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/typelivore/run_length_encode.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestRunLengthEncode {
+
+
+
+
+/******************************************************************************************************/
+// Runs of the same element are not merged across other elements.
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, float, int>, Shuttle<size_t{2}, size_t{1}, size_t{3}>>
+
+SAME_TYPE(RunLengthEncode<int, int, float, int, int, int>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Capsule<void>
+
+SAME_TYPE(RunLengthEncode<void, void>::Distinct);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{2}>
+
+SAME_TYPE(RunLengthEncode<void, void>::Counts);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<>, Shuttle<>>
+
+SAME_TYPE(RunLengthEncode<>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_SCATTER_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_SCATTER_H
+
+#include "conceptrodon/metafunctions/typelivore/scatter.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/fragmental/sheep.hpp"
+#include "macaron/fragmental/sheep_reversed.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+#include "macaron/fragmental/amenity/define_sheep_reversed.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestScatter {
+
+
+
+
+/****************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<char*, int*, int**, char>
+
+SAME_TYPE(Scatter<int, int*, int**, void>::Page<3, 0>::Mold<char, char*>::Road<Capsule>);
+
+#undef SUPPOSED_TYPE
+/****************************************************************************************************/
+
+
+
+
+/****************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<int, char*>
+
+SAME_TYPE(Scatter<int, int*>::Page<1, 1>::Mold<char, char*>::Road<Capsule>);
+
+#undef SUPPOSED_TYPE
+/****************************************************************************************************/
+
+
+
+
+/****************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep_reversed.hpp"
+using SupposedResult = Capsule<SHEEP_REVERSED_SPROUT(240)>;
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep_reversed.hpp"
+
+#include "macaron/fragmental/amenity/instances/define_integral_constant_sheep.hpp"
+#include "macaron/fragmental/amenity/instances/define_integer_sheep_reversed.hpp"
+using Result = Scatter<SHEEP_SPROUT(240, +240)>
+::Page<SHEEP_REVERSED_SPROUT(240)>
+::Mold<SHEEP_SPROUT(240)>
+::Road<Capsule>;
+#include "macaron/fragmental/amenity/instances/undef_integral_constant_sheep.hpp"
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep_reversed.hpp"
+/****************************************************************************************************/
+
+
+
+
+/****************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+SAME_TYPE(Result);
+
+#undef SUPPOSED_TYPE
+/****************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+#include "macaron/fragmental/amenity/undef_sheep_reversed.hpp"
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_TYPICAL_TOPOLOGICAL_SORT_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_TYPICAL_TOPOLOGICAL_SORT_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/label.hpp"
+#include "conceptrodon/metafunctions/typelivore/typical_topological_sort.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestTypicalTopologicalSort {
+
+
+
+
+/******************************************************************************************************/
+struct Config;
+struct Log;
+struct Network;
+struct Metrics;
+struct Application;
+
+template<size_t I>
+struct Subsystem;
+
+// A chain where the `I`th subsystem depends on the next one.
+template<size_t Length, size_t I>
+using Link = Label
+<
+    Subsystem<I>,
+    std::conditional_t<(I + 1 < Length), Capsule<Subsystem<I + 1>>, Capsule<>>
+>;
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Capsule<Config, Log, Network, Metrics, Application>
+
+SAME_TYPE
+(
+    TypicalTopologicalSort
+    <
+        Label<Application, Capsule<Network, Metrics>>,
+        Label<Network, Capsule<Config, Log>>,
+        Label<Metrics, Capsule<Log>>,
+        Label<Log, Capsule<Config>>,
+        Label<Config, Capsule<>>
+    >::type
+);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Independent subsystems keep their order.
+#define SUPPOSED_TYPE \
+    Capsule<Log, Config, Application>
+
+SAME_TYPE
+(
+    TypicalTopologicalSort
+    <
+        Label<Log, Capsule<>>,
+        Label<Config, Capsule<>>,
+        Label<Application, Capsule<Log, Config>>
+    >::type
+);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Capsule<>
+
+SAME_TYPE(TypicalTopologicalSort<>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// A chain of 500 subsystems is reversed.
+template<size_t...I>
+auto chain(std::index_sequence<I...>)
+-> TypicalTopologicalSort<Link<sizeof...(I), I>...>::type;
+
+template<size_t...I>
+auto reversed(std::index_sequence<I...>)
+-> Capsule<Subsystem<sizeof...(I) - 1 - I>...>;
+
+#define SUPPOSED_TYPE \
+    decltype(reversed(std::make_index_sequence<500>{}))
+
+SAME_TYPE(decltype(chain(std::make_index_sequence<500>{})));
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_WINDOW_H
+#define CONCEPTRODON_TYPELIVORE_UNIT_TESTS_TEST_WINDOW_H
+
+#include "conceptrodon/metafunctions/typelivore/window.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Typelivore {
+namespace UnitTests {
+namespace TestWindow {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, int*, int**>, Capsule<int*, int**, int***>, Capsule<int**, int***, int****>>
+
+SAME_TYPE(Window<int, int*, int**, int***, int****>::Page<3>);
+SAME_TYPE(Window<int, int*, int**, int***, int****>::Page<3, 1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, int*>, Capsule<int**, int***>>
+
+SAME_TYPE(Window<int, int*, int**, int***, int****>::Page<2, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int, void>, Capsule<int[2], int()>>
+
+SAME_TYPE(Window<int, void, int[2], int(), int*>::Page<2, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Capsule<int>, Capsule<int**>>
+
+SAME_TYPE(Window<int, int*, int**, int***>::Page<1, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(Window<int, int*>::Page<3>);
+SAME_TYPE(Window<>::Page<1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
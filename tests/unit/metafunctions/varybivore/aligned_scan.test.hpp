@@ -0,0 +1,65 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_ALIGNED_SCAN_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_ALIGNED_SCAN_H
+
+#include <cstddef>
+
+#include "conceptrodon/metafunctions/varybivore/aligned_scan.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestAlignedScan {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{0}, size_t{8}, size_t{16}, size_t{20}>
+
+SAME_TYPE(AlignedScan<1, 8, 2, 4>::Page<1, 8, 2, 4>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Alignments need not be powers of two.
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{0}, size_t{3}, size_t{5}, size_t{10}>
+
+SAME_TYPE(AlignedScan<2, 2, 5, 1>::Page<1, 3, 5, 1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(AlignedScan<>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_BINARY_SEARCH_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_BINARY_SEARCH_H
+
+#include "conceptrodon/metafunctions/varybivore/binary_search.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/judgmental/invalid.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/judgmental/amenity/define_invalid.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestBinarySearch {
+
+
+
+
+/******************************************************************************************************/
+VALID(BinarySearch<1, 3, 3, 5>::Page_v<1>);
+VALID(BinarySearch<1, 3, 3, 5>::Page<5>::value);
+VALID(BinarySearch<1, 3, 3, 5>::Page_v<3l>);
+
+// Variables of different types are converted to their common type.
+VALID(BinarySearch<1, 3l, 5u>::Page_v<3>);
+VALID(BinarySearch<1, 3l, 5u>::Page_v<5>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+INVALID(BinarySearch<1, 3, 3, 5>::Page_v<4>);
+INVALID(BinarySearch<1, 3, 3, 5>::Page_v<0>);
+INVALID(BinarySearch<>::Page_v<0>);
+INVALID(BinarySearch<1, 3l, 5u>::Page_v<4>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Signed lists accept unsigned targets.
+VALID(BinarySearch<-3, 2l>::Page_v<2u>);
+VALID(BinarySearch<-3, -1, 2>::Page_v<-3l>);
+INVALID(BinarySearch<-3, 2>::Page_v<0u>);
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/judgmental/amenity/undef_invalid.hpp"
+
+#endif
\ No newline at end of file
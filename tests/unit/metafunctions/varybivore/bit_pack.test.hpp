@@ -0,0 +1,110 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_BIT_PACK_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_BIT_PACK_H
+
+#include "conceptrodon/metafunctions/varybivore/bit_pack.hpp"
+
+#include "macaron/judgmental/valid.hpp"
+#include "macaron/judgmental/invalid.hpp"
+#include "macaron/judgmental/equal_value.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_valid.hpp"
+#include "macaron/judgmental/amenity/define_invalid.hpp"
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestBitPack {
+
+
+
+
+/******************************************************************************************************/
+VALID(BitPack<true, false, 1, 0>::value.test(0));
+INVALID(BitPack<true, false, 1, 0>::value.test(1));
+VALID(BitPack_v<true, false, 1, 0>.test(2));
+VALID(BitPack_v<true, false, 1, 0>.any());
+INVALID(BitPack_v<true, false, 1, 0>.all());
+VALID(BitPack_v<true, true, 1>.all());
+INVALID(BitPack_v<false, 0>.any());
+VALID(BitPack_v<>.all());
+INVALID(BitPack_v<>.any());
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+VALID((BitPack_v<true, false, 1, 0> & BitPack_v<true, true, 0, 0>) == BitPack_v<true, false, 0, 0>);
+VALID((BitPack_v<true, false, 1, 0> | BitPack_v<true, true, 0, 0>) == BitPack_v<true, true, 1, 0>);
+VALID(~BitPack_v<true, false, 1, 0> == BitPack_v<false, true, 0, 1>);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    2
+
+EQUAL_VALUE(BitPack_v<true, false, 1, 0>.count());
+EQUAL_VALUE(BitPack_v<0, 0, 0, 1, 1>.first() - 1);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    -1
+
+EQUAL_VALUE(BitPack_v<0, 0, 0>.first());
+EQUAL_VALUE(BitPack_v<>.first());
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    239
+
+#include "macaron/fragmental/amenity/instances/define_integer_sheep.hpp"
+EQUAL_VALUE(BitPack_v<SHEEP_SPROUT(240, == 239)>.first());
+EQUAL_VALUE(BitPack_v<0, SHEEP_SPROUT(240, != 0)>.count());
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep.hpp"
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integer_sheep.hpp"
+VALID(BitPack_v<SHEEP_SPROUT(240, < 240)>.all());
+VALID((~BitPack_v<SHEEP_SPROUT(240, < 240)>).first() == -1);
+VALID((~BitPack_v<SHEEP_SPROUT(130, < 129)>).first() == 129);
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_valid.hpp"
+#include "macaron/judgmental/amenity/undef_invalid.hpp"
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
@@ -0,0 +1,88 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_CHUNK_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_CHUNK_H
+
+#include "conceptrodon/metafunctions/varybivore/chunk.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestChunk {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<0, 1>, Shuttle<2, 3>, Shuttle<4>>
+
+SAME_TYPE(Chunk<0, 1, 2, 3, 4>::Page<2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<1, 'a'>, Shuttle<nullptr, true>>
+
+SAME_TYPE(Chunk<1, 'a', nullptr, true>::Page<2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<0>, Shuttle<0>, Shuttle<1>>
+
+SAME_TYPE(Chunk<0, 0, 1>::Page<1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<0, 1, 2>>
+
+SAME_TYPE(Chunk<0, 1, 2>::Page<3>);
+SAME_TYPE(Chunk<0, 1, 2>::Page<5>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(Chunk<>::Page<2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
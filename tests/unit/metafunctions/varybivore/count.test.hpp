@@ -0,0 +1,58 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_COUNT_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_COUNT_H
+
+#include "conceptrodon/metafunctions/varybivore/count.hpp"
+
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestCount {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    3
+
+EQUAL_VALUE(Count<1, 2, 1, 1u, 2, 1>::Page_v<1>);
+EQUAL_VALUE(Count<1, 2, 1, 1u, 2, 1>::Page<1>::value);
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE  \
+    1
+
+EQUAL_VALUE(Count<1, 2, 1, 1u, 2, 1>::Page_v<1u>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    0
+
+EQUAL_VALUE(Count<1, 2, 1, 1u, 2, 1>::Page_v<3>);
+EQUAL_VALUE(Count<>::Page_v<1>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
\ No newline at end of file
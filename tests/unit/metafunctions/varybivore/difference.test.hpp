@@ -0,0 +1,75 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_DIFFERENCE_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_DIFFERENCE_H
+
+#include "conceptrodon/metafunctions/varybivore/difference.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestDifference {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Shuttle<1>
+
+SAME_TYPE(Difference<1, 2, 3>::Page<3, 4, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Shuttle<1, 2>
+
+SAME_TYPE(Difference<1, 2>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integer_sheep.hpp"
+using SupposedResult = Shuttle<>;
+using Result = Difference<SHEEP_SPROUT(240)>::Page<SHEEP_SPROUT(480)>;
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+SAME_TYPE(Result);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
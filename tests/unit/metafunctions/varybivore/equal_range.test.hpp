@@ -0,0 +1,78 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_EQUAL_RANGE_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_EQUAL_RANGE_H
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/varybivore/equal_range.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestEqualRange {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{1}, size_t{3}>
+
+SAME_TYPE(EqualRange<1, 3, 3, 5>::Page<3>);
+SAME_TYPE(EqualRange<1, 3l, 3u, 5>::Page<3>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{3}, size_t{3}>
+
+SAME_TYPE(EqualRange<1, 3, 3, 5>::Page<4>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{0}, size_t{0}>
+
+SAME_TYPE(EqualRange<>::Page<4>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Targets are converted to the type of the list before they are compared.
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{1}, size_t{3}>
+
+SAME_TYPE(EqualRange<-5, -1, -1, 2>::Page<-1l>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{3}, size_t{3}>
+
+SAME_TYPE(EqualRange<-5, -1, -1, 2>::Page<0u>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
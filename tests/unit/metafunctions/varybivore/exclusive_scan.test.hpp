@@ -0,0 +1,92 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_EXCLUSIVE_SCAN_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_EXCLUSIVE_SCAN_H
+
+#include <cstddef>
+#include <functional>
+
+#include "conceptrodon/metafunctions/varybivore/exclusive_scan.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestExclusiveScan {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<0, 1, 3, 6>
+
+SAME_TYPE(ExclusiveScan<1, 2, 3, 4>::Page<0>);
+SAME_TYPE(ExclusiveScan<1, 2, 3, 4>::Page<0, std::plus<> {}>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 1, 2, 6>
+
+SAME_TYPE(ExclusiveScan<1, 2, 3, 4>::Page<1, std::multiplies<> {}>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Totals take the type of the initial value.
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{10}, size_t{11}, size_t{13}>
+
+SAME_TYPE(ExclusiveScan<1, 2, 3>::Page<size_t{10}>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(ExclusiveScan<>::Page<0>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types are converted to their common type.
+#define SUPPOSED_TYPE   \
+    Shuttle<0l, -4l, -2l>
+
+SAME_TYPE(ExclusiveScan<-4, 2u, 3l>::Page<0l>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
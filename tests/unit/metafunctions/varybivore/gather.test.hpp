@@ -0,0 +1,85 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_GATHER_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_GATHER_H
+
+#include "conceptrodon/metafunctions/varybivore/gather.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/fragmental/sheep.hpp"
+#include "macaron/fragmental/sheep_reversed.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+#include "macaron/fragmental/amenity/define_sheep_reversed.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestGather {
+
+
+
+
+/****************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Shuttle<'c', 0, 0>
+
+SAME_TYPE(Gather<0, 1, 2, 'c'>::Page<3, 0, 0>::Rail<Shuttle>);
+
+#undef SUPPOSED_TYPE
+/****************************************************************************************************/
+
+
+
+
+/****************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Shuttle<>
+
+SAME_TYPE(Gather<0, 1>::Page<>::Rail<Shuttle>);
+
+#undef SUPPOSED_TYPE
+/****************************************************************************************************/
+
+
+
+
+/****************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integer_sheep_reversed.hpp"
+using SupposedResult = Shuttle<SHEEP_REVERSED_SPROUT(240)>;
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep_reversed.hpp"
+
+#include "macaron/fragmental/amenity/instances/define_integer_sheep.hpp"
+#include "macaron/fragmental/amenity/instances/define_integer_sheep_reversed.hpp"
+using Result = Gather<SHEEP_SPROUT(240)>
+::Page<SHEEP_REVERSED_SPROUT(240)>
+::Rail<Shuttle>;
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep.hpp"
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep_reversed.hpp"
+/****************************************************************************************************/
+
+
+
+
+/****************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+SAME_TYPE(Result);
+
+#undef SUPPOSED_TYPE
+/****************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+#include "macaron/fragmental/amenity/undef_sheep_reversed.hpp"
+
+#endif
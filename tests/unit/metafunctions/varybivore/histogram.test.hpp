@@ -0,0 +1,66 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_HISTOGRAM_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_HISTOGRAM_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/varybivore/histogram.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestHistogram {
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types are distinct.
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<1, 2, 1u>, Shuttle<size_t{3}, size_t{2}, size_t{1}>>
+
+SAME_TYPE(Histogram<1, 2, 1, 1u, 2, 1>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<'a', 'b'>
+
+SAME_TYPE(Histogram<'a', 'b', 'b', 'a', 'a'>::Distinct);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<size_t{3}, size_t{2}>
+
+SAME_TYPE(Histogram<'a', 'b', 'b', 'a', 'a'>::Counts);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<>, Shuttle<>>
+
+SAME_TYPE(Histogram<>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
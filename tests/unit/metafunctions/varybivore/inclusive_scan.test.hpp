@@ -0,0 +1,101 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_INCLUSIVE_SCAN_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_INCLUSIVE_SCAN_H
+
+#include <cstddef>
+#include <functional>
+
+#include "conceptrodon/metafunctions/varybivore/inclusive_scan.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestInclusiveScan {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 3, 6, 10>
+
+SAME_TYPE(InclusiveScan<1, 2, 3, 4>::Page<>);
+SAME_TYPE(InclusiveScan<1, 2, 3, 4>::Page<std::plus<> {}>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 2, 6, 24>
+
+SAME_TYPE(InclusiveScan<1, 2, 3, 4>::Page<std::multiplies<> {}>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+constexpr auto maximum = [](int left, int right)
+{ return left < right ? right : left; };
+
+#define SUPPOSED_TYPE   \
+    Shuttle<3, 3, 4, 4, 5>
+
+SAME_TYPE(InclusiveScan<3, 1, 4, 1, 5>::Page<maximum>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(InclusiveScan<>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types are accumulated in their common type.
+#define SUPPOSED_TYPE   \
+    Shuttle<1l, 3l>
+
+SAME_TYPE(InclusiveScan<1, 2l>::Page<>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<-4l, -2l, 1l>
+
+SAME_TYPE(InclusiveScan<-4, 2u, 3l>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_INTERSECTION_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_INTERSECTION_H
+
+#include "conceptrodon/metafunctions/varybivore/intersection.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/fragmental/sheep.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/fragmental/amenity/define_sheep.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestIntersection {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Shuttle<2, 3>
+
+SAME_TYPE(Intersection<1, 2, 3>::Page<3, 4, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Shuttle<>
+
+SAME_TYPE(Intersection<1, 2>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#include "macaron/fragmental/amenity/instances/define_integer_sheep.hpp"
+using SupposedResult = Shuttle<SHEEP_SPROUT(240)>;
+using Result = Intersection<SHEEP_SPROUT(480)>::Page<SHEEP_SPROUT(240)>;
+#include "macaron/fragmental/amenity/instances/undef_integer_sheep.hpp"
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    SupposedResult
+
+SAME_TYPE(Result);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/fragmental/amenity/undef_sheep.hpp"
+
+#endif
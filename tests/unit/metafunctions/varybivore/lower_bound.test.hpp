@@ -0,0 +1,82 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_LOWER_BOUND_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_LOWER_BOUND_H
+
+#include "conceptrodon/metafunctions/varybivore/lower_bound.hpp"
+
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestLowerBound {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    1
+
+EQUAL_VALUE(LowerBound<1, 3, 3, 5>::Page_v<3>);
+EQUAL_VALUE(LowerBound<1, 3, 3, 5>::Page<2>::value);
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE  \
+    4
+
+EQUAL_VALUE(LowerBound<1, 3, 3, 5>::Page_v<6>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Targets of other types are compared by `<`.
+#define SUPPOSED_VALUE  \
+    3
+
+EQUAL_VALUE(LowerBound<1, 3, 3, 5>::Page_v<4l>);
+EQUAL_VALUE(LowerBound<1, 3l, 3u, 5>::Page_v<4>);
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE  \
+    0
+
+EQUAL_VALUE(LowerBound<1, 3, 3, 5>::Page_v<0>);
+EQUAL_VALUE(LowerBound<>::Page_v<0>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Unsigned targets are converted to the type of a signed list before they are compared.
+#define SUPPOSED_VALUE  \
+    2
+
+EQUAL_VALUE(LowerBound<-5, -1, 2>::Page_v<0u>);
+EQUAL_VALUE(LowerBound<-5, -1l, 2>::Page_v<0u>);
+EQUAL_VALUE(LowerBound<-5, -1l, 2u>::Page_v<2>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_MERGE_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_MERGE_H
+
+#include <functional>
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/varybivore/merge.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestMerge {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 2, 3, 3, 5, 6>
+
+SAME_TYPE(Merge<1, 3, 5>::Page<2, 3, 6>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<6, 5, 3, 3, 2, 1>
+
+SAME_TYPE(Merge<5, 3, 1>::Order<std::ranges::greater {}>::Page<6, 3, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+constexpr auto by_tens = [](int left, int right)
+{ return left / 10 < right / 10; };
+
+// Equivalent variables from the first list come first.
+#define SUPPOSED_TYPE   \
+    Shuttle<11, 10, 25, 29, 21>
+
+SAME_TYPE(Merge<11, 25, 29>::Order<by_tens>::Page<10, 21>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 2>
+
+SAME_TYPE(Merge<>::Page<1, 2>);
+SAME_TYPE(Merge<1, 2>::Page<>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(Merge<>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types are merged in their common type.
+#define SUPPOSED_TYPE   \
+    Shuttle<1l, 2l>
+
+SAME_TYPE(Merge<1>::Page<2l>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<-3l, 0l, 2l, 4l>
+
+SAME_TYPE(Merge<-3, 4>::Page<0l, 2u>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
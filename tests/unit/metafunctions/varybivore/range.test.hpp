@@ -0,0 +1,207 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_RANGE_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_RANGE_H
+
+#include <utility>
+
+#include "conceptrodon/metafunctions/varybivore/range.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestRange {
+
+
+
+
+/******************************************************************************************************/
+template<auto...>
+struct Operation;
+
+template<auto Variable>
+struct Twice
+{ static constexpr auto value {Variable * 2}; };
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+static_assert(Range<0, 10>::size() == 10);
+static_assert(Range<0, 10, 3>::size() == 4);
+static_assert(Range<10, 0, -3>::size() == 4);
+static_assert(Range<5, 5>::size() == 0);
+static_assert(Range<5, 0>::size() == 0);
+static_assert(Range<size_t{10}, size_t{0}, -1>::size() == 10);
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    9999
+
+EQUAL_VALUE(Range<0, 10000>::Among<9999>::value);
+EQUAL_VALUE(Range<0, 10000>::Among_v<9999>);
+EQUAL_VALUE(Range<10000, 0, -1>::Among<1>::value);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE \
+    102
+
+EQUAL_VALUE
+(
+    Range<0, 10000>::Slice<100, 9000>
+    ::Erase<5, 8000>
+    ::Rotate<3>
+    ::TurnOver
+    ::Among<0>::value
+);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Range<20, 50, 10>
+
+SAME_TYPE(Range<0, 100, 10>::Slice<2, 5>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<20, 30, 40>
+
+SAME_TYPE(Range<0, 100, 10>::Slice<2, 5>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<7, 8, 9>
+
+SAME_TYPE(Range<0, 10>::Slice<7>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Slices of unsigned ranges with a negative step must not wrap their bound.
+static_assert(Range<10u, 0u, -3>::Slice<0, 4>::size() == 4);
+static_assert(Range<10u, 0u, -3>::Slice<1>::size() == 3);
+static_assert(Range<10u, 0u, -3>::Slice<1, 3>::size() == 2);
+static_assert(Range<10u, 0u, -3>::Slice<4>::size() == 0);
+static_assert(Range<10, -10, -4>::Slice<2>::size() == 3);
+
+#define SUPPOSED_TYPE \
+    Operation<7u, 4u, 1u>
+
+SAME_TYPE(Range<10u, 0u, -3>::Slice<1>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<4u, 1u>
+
+SAME_TYPE(Range<10u, 0u, -3>::Slice<2, 4>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<2, -2, -6>
+
+SAME_TYPE(Range<10, -10, -4>::Slice<2>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Operation<0, 3, 4>
+
+SAME_TYPE(Range<0, 5>::Erase<1, 3>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<0, 1, 2, 3>
+
+SAME_TYPE(Range<0, 5>::Erase<4>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    Operation<2, 3, 4, 0, 1>
+
+SAME_TYPE(Range<0, 5>::Rotate<2>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<4, 3, 2, 1, 0>
+
+SAME_TYPE(Range<0, 5>::TurnOver::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<0, 2, 4, 6, 8>
+
+SAME_TYPE(Range<0, 5>::Gauge<Twice>::UniRail<Operation>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE \
+    std::make_index_sequence<3>
+
+SAME_TYPE(Range<size_t{0}, size_t{3}>::Rail<std::index_sequence>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE \
+    Operation<>
+
+SAME_TYPE(Range<0, 0>::Rail<Operation>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
@@ -0,0 +1,59 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_RUN_LENGTH_ENCODE_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_RUN_LENGTH_ENCODE_H
+
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/varybivore/run_length_encode.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestRunLengthEncode {
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types break a run.
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<1, 1u, 2>, Shuttle<size_t{2}, size_t{1}, size_t{3}>>
+
+SAME_TYPE(RunLengthEncode<1, 1, 1u, 2, 2, 2>::type);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<'a', 'b', 'a'>
+
+SAME_TYPE(RunLengthEncode<'a', 'b', 'b', 'a', 'a'>::Distinct);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<>, Shuttle<>>
+
+SAME_TYPE(RunLengthEncode<>::type);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
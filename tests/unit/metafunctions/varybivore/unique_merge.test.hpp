@@ -0,0 +1,96 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_UNIQUE_MERGE_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_UNIQUE_MERGE_H
+
+#include <functional>
+
+#include "conceptrodon/utilities/shuttle.hpp"
+#include "conceptrodon/metafunctions/varybivore/unique_merge.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestUniqueMerge {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 2, 3, 5, 6>
+
+SAME_TYPE(UniqueMerge<1, 3, 3, 5>::Page<2, 3, 6>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<6, 3, 2>
+
+SAME_TYPE(UniqueMerge<6, 3, 3>::Order<std::ranges::greater {}>::Page<3, 2, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+constexpr auto by_tens = [](int left, int right)
+{ return left / 10 < right / 10; };
+
+// The first list wins ties.
+#define SUPPOSED_TYPE   \
+    Shuttle<11, 25, 30>
+
+SAME_TYPE(UniqueMerge<11, 25>::Order<by_tens>::Page<10, 21, 30>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Shuttle<1, 2>
+
+SAME_TYPE(UniqueMerge<>::Page<1, 1, 2>);
+SAME_TYPE(UniqueMerge<1, 2, 2>::Page<>);
+
+#undef SUPPOSED_TYPE
+
+#define SUPPOSED_TYPE   \
+    Shuttle<>
+
+SAME_TYPE(UniqueMerge<>::Page<>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Variables of different types are merged in their common type.
+#define SUPPOSED_TYPE   \
+    Shuttle<-1l, 2l>
+
+SAME_TYPE(UniqueMerge<-1, 2>::Page<-1l, 2u>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_UPPER_BOUND_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_UPPER_BOUND_H
+
+#include "conceptrodon/metafunctions/varybivore/upper_bound.hpp"
+
+#include "macaron/judgmental/equal_value.hpp"
+
+#include "macaron/judgmental/amenity/define_equal_value.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestUpperBound {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    3
+
+EQUAL_VALUE(UpperBound<1, 3, 3, 5>::Page_v<3>);
+EQUAL_VALUE(UpperBound<1, 3, 3, 5>::Page<4>::value);
+EQUAL_VALUE(UpperBound<1, 3l, 3u, 5>::Page_v<3>);
+
+#undef SUPPOSED_VALUE
+
+#define SUPPOSED_VALUE  \
+    4
+
+EQUAL_VALUE(UpperBound<1, 3, 3, 5>::Page_v<5>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_VALUE  \
+    0
+
+EQUAL_VALUE(UpperBound<1, 3, 3, 5>::Page_v<0>);
+EQUAL_VALUE(UpperBound<>::Page_v<0>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+// Unsigned targets are converted to the type of a signed list before they are compared.
+#define SUPPOSED_VALUE  \
+    2
+
+EQUAL_VALUE(UpperBound<-5, -1, 2>::Page_v<0u>);
+EQUAL_VALUE(UpperBound<-5, -1, 2>::Page_v<-1l>);
+EQUAL_VALUE(UpperBound<-5, -1l, 2u>::Page_v<1>);
+
+#undef SUPPOSED_VALUE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_equal_value.hpp"
+
+#endif
\ No newline at end of file
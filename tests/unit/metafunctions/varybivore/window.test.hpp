@@ -0,0 +1,89 @@
+// Copyright 2024 Feng Mofan
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_WINDOW_H
+#define CONCEPTRODON_VARYBIVORE_UNIT_TESTS_TEST_WINDOW_H
+
+#include "conceptrodon/metafunctions/varybivore/window.hpp"
+#include "conceptrodon/utilities/capsule.hpp"
+#include "conceptrodon/utilities/shuttle.hpp"
+
+#include "macaron/judgmental/same_type.hpp"
+
+#include "macaron/judgmental/amenity/define_same_type.hpp"
+
+namespace Conceptrodon {
+namespace Varybivore {
+namespace UnitTests {
+namespace TestWindow {
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<0, 1, 2>, Shuttle<1, 2, 3>, Shuttle<2, 3, 4>>
+
+SAME_TYPE(Window<0, 1, 2, 3, 4>::Page<3>);
+SAME_TYPE(Window<0, 1, 2, 3, 4>::Page<3, 1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<0, 1>, Shuttle<2, 3>>
+
+SAME_TYPE(Window<0, 1, 2, 3, 4>::Page<2, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<1, 'a'>, Shuttle<nullptr, true>>
+
+SAME_TYPE(Window<1, 'a', nullptr, true, 2>::Page<2, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<Shuttle<0>, Shuttle<2>>
+
+SAME_TYPE(Window<0, 1, 2, 3>::Page<1, 2>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+/******************************************************************************************************/
+#define SUPPOSED_TYPE   \
+    Capsule<>
+
+SAME_TYPE(Window<0, 1>::Page<3>);
+SAME_TYPE(Window<>::Page<1>);
+
+#undef SUPPOSED_TYPE
+/******************************************************************************************************/
+
+
+
+
+}}}}
+
+#include "macaron/judgmental/amenity/undef_same_type.hpp"
+
+#endif
\ No newline at end of file